@@ -0,0 +1,102 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      Common/Arena.h
+// Status    DEV
+
+#pragma once
+
+// ===== C++ ================================================================
+#include <new>
+#include <utility>
+#include <vector>
+
+// The Arena allocates objects and strings from large blocks. It does not
+// free them one by one, Reset destroys all the objects, in the reverse
+// order of their creation, and makes the blocks available again.
+class Arena
+{
+
+public:
+
+    Arena();
+
+    ~Arena();
+
+    // Exception  RESULT_TOO_LARGE  aSize_byte exceeds the size of a block,
+    //                              64 KiB
+    void* Allocate(unsigned int aSize_byte, unsigned int aAlign_byte);
+
+    // Exception  RESULT_TOO_LARGE  See Allocate
+    const char   * Copy(const char   * aString);
+    const wchar_t* Copy(const wchar_t* aString);
+
+    // Reserve returns space for aMax_byte bytes without allocating it.
+    // Commit then allocates the aSize_byte first bytes. Nothing else may be
+    // allocated between both calls.
+    //
+    // Exception  RESULT_TOO_LARGE  See Allocate
+    void* Reserve(unsigned int aMax_byte, unsigned int aAlign_byte);
+    void  Commit (unsigned int aSize_byte);
+
+    template <typename T, typename... A>
+    T* New(A&&... aArgs);
+
+    void Reset();
+
+private:
+
+    NO_COPY(Arena);
+
+    class Destructor
+    {
+
+    public:
+
+        Destructor* mNext;
+        void      * mObject;
+
+        void (*mDestroy)(void* aObject);
+
+    };
+
+    template <typename T>
+    static void Destroy(void* aObject);
+
+    std::vector<uint8_t*> mBlocks;
+
+    unsigned int mBlock;
+    Destructor * mDestructors;
+    unsigned int mOffset_byte;
+
+};
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename... A>
+T* Arena::New(A&&... aArgs)
+{
+    auto lDestructor = static_cast<Destructor*>(Allocate(sizeof(Destructor), alignof(Destructor)));
+
+    auto lResult = new (Allocate(sizeof(T), alignof(T))) T(std::forward<A>(aArgs)...);
+
+    lDestructor->mDestroy = Destroy<T>;
+    lDestructor->mNext    = mDestructors;
+    lDestructor->mObject  = lResult;
+
+    mDestructors = lDestructor;
+
+    return lResult;
+}
+
+// Private
+// //////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+void Arena::Destroy(void* aObject)
+{
+    static_cast<T*>(aObject)->~T();
+}
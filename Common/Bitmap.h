@@ -0,0 +1,68 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      Common/Bitmap.h
+// Status    DEV
+
+#pragma once
+
+// ===== C++ ================================================================
+#include <vector>
+
+// The Bitmap tracks the occupied slots of a fixed size table. The searches
+// test 32 slots at a time.
+class Bitmap
+{
+
+public:
+
+    static const unsigned int NOT_FOUND;
+
+    Bitmap(unsigned int aSize);
+
+    void Clear();
+    void Clear(unsigned int aBit);
+
+    void Set(unsigned int aBit);
+    void Set(unsigned int aFirst, unsigned int aCount);
+
+    bool Test(unsigned int aBit) const;
+
+    unsigned int GetSize() const;
+
+    // aFirst  The first bit to consider
+    // aEnd    The bit following the last one to consider
+    //
+    // Return  The highest (Dec) or lowest (Inc) set bit of the range, or
+    //         NOT_FOUND
+    unsigned int FindOne_Dec (unsigned int aFirst, unsigned int aEnd) const;
+    unsigned int FindOne_Inc (unsigned int aFirst, unsigned int aEnd) const;
+
+    // Return  The highest (Dec) or lowest (Inc) cleared bit of the range,
+    //         or NOT_FOUND
+    unsigned int FindZero_Dec(unsigned int aFirst, unsigned int aEnd) const;
+    unsigned int FindZero_Inc(unsigned int aFirst, unsigned int aEnd) const;
+
+    // aCount  The number of consecutive cleared bits to find
+    //
+    // Return  The first bit of the highest (Dec) or lowest (Inc) run of
+    //         aCount cleared bits inside the range, or NOT_FOUND
+    unsigned int FindZeros_Dec(unsigned int aFirst, unsigned int aEnd, unsigned int aCount) const;
+    unsigned int FindZeros_Inc(unsigned int aFirst, unsigned int aEnd, unsigned int aCount) const;
+
+private:
+
+    NO_COPY(Bitmap);
+
+    unsigned int Find_Dec(unsigned int aFirst, unsigned int aEnd, uint32_t aInvert) const;
+    unsigned int Find_Inc(unsigned int aFirst, unsigned int aEnd, uint32_t aInvert) const;
+
+    uint32_t GetWord(unsigned int aWord, unsigned int aFirst, unsigned int aEnd, uint32_t aInvert) const;
+
+    unsigned int mSize;
+
+    std::vector<uint32_t> mWords;
+
+};
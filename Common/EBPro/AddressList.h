@@ -18,6 +18,8 @@
 #include "../Address.h"
 #include "../AddressList.h"
 
+#include "../Snapshot.h"
+
 #include "List.h"
 
 namespace EBPro
@@ -40,8 +42,13 @@ namespace EBPro
 
         void Parse();
 
+        // Exception  RESULT_INVALID_FORMAT
+        void ReadSnapshot(SnapshotReader* aReader);
+
         void Verify() const;
 
+        void WriteSnapshot(SnapshotWriter* aWriter) const;
+
         // ===== List =======================================================
         virtual ~AddressList();
 
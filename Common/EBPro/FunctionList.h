@@ -12,6 +12,8 @@
 #include <KMS/File/Binary.h>
 
 // ===== Local ==============================================================
+#include "../Snapshot.h"
+
 #include "List.h"
 
 namespace EBPro
@@ -31,6 +33,11 @@ namespace EBPro
 
         void Parse();
 
+        // Exception  RESULT_INVALID_FORMAT
+        void ReadSnapshot(SnapshotReader* aReader);
+
+        void WriteSnapshot(SnapshotWriter* aWriter) const;
+
         // ===== List =======================================================
         virtual ~FunctionList();
 
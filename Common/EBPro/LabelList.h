@@ -12,6 +12,8 @@
 #include <vector>
 
 // ===== Local ==============================================================
+#include "../Snapshot.h"
+
 #include "List.h"
 
 namespace EBPro
@@ -34,10 +36,15 @@ namespace EBPro
 
         void Parse();
 
+        // Exception  RESULT_INVALID_FORMAT
+        void ReadSnapshot(SnapshotReader* aReader);
+
         void ValidateConfig() const;
 
         void Verify() const;
 
+        void WriteSnapshot(SnapshotWriter* aWriter) const;
+
         // ===== List =======================================================
         virtual ~LabelList();
         virtual void Read();
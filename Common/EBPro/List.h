@@ -36,6 +36,10 @@ namespace EBPro
 
         virtual ~List();
 
+        // aOut  The hash and the size of the exported file, 0 and 0 when
+        //       it is not configured or does not exist
+        void GetExportedKey(uint64_t* aOut) const;
+
         void Import();
 
         virtual void Read();
@@ -8,6 +8,9 @@
 
 #pragma once
 
+// ===== C++ ================================================================
+#include <vector>
+
 // ===== Local ==============================================================
 #include "AddressList.h"
 #include "FunctionList.h"
@@ -23,8 +26,10 @@ namespace EBPro
     public:
 
         static const char* FILE_NAME_DEFAULT;
+        static const char* SNAPSHOT_FILE_DEFAULT;
 
         KMS::DI::String_Expand mFileName;
+        KMS::DI::String_Expand mSnapshotFile;
 
         Project();
 
@@ -46,6 +51,21 @@ namespace EBPro
 
     private:
 
+        // Read uses the snapshot instead of reading the exported files.
+        // Parse then uses ReadSnapshot_Lists to load the objects.
+        //
+        // Return  false when the snapshot does not exist or when it does not
+        //         correspond to the exported files and to this version of
+        //         the tool
+        bool ReadSnapshot();
+        void ReadSnapshot_Lists();
+        void WriteSnapshot() const;
+
+        // The hash and the size of the CSV, MLB and LBL files
+        uint64_t mKey[6];
+
+        std::vector<uint8_t> mSnapshot;
+
         LabelList    mLabels;
         FunctionList mFunctions;
         Software     mSoftware;
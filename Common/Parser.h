@@ -9,6 +9,9 @@
 // ===== C ==================================================================
 #include <stdio.h>
 
+// The Parser reads a source file one line at a time. It skips the empty
+// lines and the comment lines, which start with #, so the caller sees each
+// useful line only once. The end of line, \n or \r\n, is removed.
 class Parser
 {
 
@@ -18,12 +21,28 @@ public:
 
     ~Parser();
 
-    bool IsAtEnd();
+    // Return  The number of the last line read, starting at 1
+    unsigned int GetLineNo() const;
 
+    // The leading blanks are removed
     bool GetNextLine(char* aOut, unsigned int aOutSize_byte);
 
+    // The leading blanks are kept
+    bool GetNextLine_Raw(char* aOut, unsigned int aOutSize_byte);
+
 private:
 
+    NO_COPY(Parser);
+
+    // aStart  The index of the first character which is not a blank
+    //
+    // Return  false at the end of the file
+    bool ReadLine(unsigned int* aStart);
+
     FILE* mFile;
 
+    char mLine[LINE_LENGTH];
+
+    unsigned int mLineNo;
+
 };
@@ -0,0 +1,122 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      Common/PatternSet.h
+// Status    DEV
+
+#pragma once
+
+// ===== C++ ================================================================
+#include <bitset>
+#include <map>
+#include <regex>
+#include <vector>
+
+// The PatternSet compiles regular expressions into a single automaton, so
+// a name is tested against all the expressions in one pass over its
+// characters. Like std::regex_match, an expression must match the whole
+// name.
+//
+// The automaton supports the literals, ., the character classes, \d \s \w
+// and their complements, the groups, | and the * + ? quantifiers. The ^ at
+// the beginning and the $ at the end of an expression are accepted. The
+// expressions using another construct are matched using std::regex.
+class PatternSet
+{
+
+public:
+
+    static const unsigned int NO_STATE;
+
+    PatternSet();
+
+    // Return  The index of the expression
+    unsigned int Add(const char* aRegEx);
+
+    void Clear();
+
+    unsigned int GetCount() const;
+
+    // aOut  The indexes of the matching expressions, in increasing order
+    void Match(const char* aName, std::vector<unsigned int>* aOut);
+
+private:
+
+    NO_COPY(PatternSet);
+
+    typedef std::bitset<256> CharSet;
+
+    typedef struct
+    {
+        unsigned int mStart;
+
+        // Each dangling transition is coded as (State index * 2 + Slot)
+        std::vector<unsigned int> mOuts;
+    }
+    Fragment;
+
+    typedef enum
+    {
+        TYPE_ACCEPT,
+        TYPE_CHAR,
+        TYPE_SPLIT,
+    }
+    Type;
+
+    typedef struct
+    {
+        Type         mType;
+        CharSet      mChars;
+        unsigned int mNext[2];
+        unsigned int mPattern;
+    }
+    State;
+
+    typedef struct
+    {
+        std::vector<unsigned int> mNFA;
+        std::vector<unsigned int> mPatterns;
+        unsigned int              mNext[256];
+    }
+    DState;
+
+    unsigned int AddState(Type aType);
+
+    void Patch(const std::vector<unsigned int>& aOuts, unsigned int aState);
+
+    // ===== Compilation ================================================
+    // Return  false when the expression uses an unsupported construct
+    bool Compile_Alt   (Fragment* aOut);
+    bool Compile_Atom  (Fragment* aOut);
+    bool Compile_Class (CharSet* aOut);
+    bool Compile_Concat(Fragment* aOut);
+    bool Compile_Escape(CharSet* aOut);
+    bool Compile_Repeat(Fragment* aOut);
+
+    // ===== Execution ==================================================
+    void         AddClosure(std::vector<unsigned int>* aSet, unsigned int aState);
+    unsigned int GetDState (std::vector<unsigned int>* aSet);
+    void         NewMark   ();
+    unsigned int Step      (unsigned int aDState, unsigned char aC);
+
+    const char* mPtr;
+
+    unsigned int mCount;
+
+    std::vector<std::pair<unsigned int, std::regex>> mFallbacks;
+
+    std::vector<unsigned int> mStarts;
+    std::vector<State>        mStates;
+
+    // The deterministic states are built as the names need them, so their
+    // number stays under the total length of the names.
+    std::map<std::vector<unsigned int>, unsigned int> mDStates_ByNFA;
+
+    std::vector<DState> mDStates;
+
+    std::vector<unsigned int> mMarks;
+    unsigned int              mMark;
+
+};
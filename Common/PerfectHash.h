@@ -0,0 +1,57 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      Common/PerfectHash.h
+// Status    DEV
+
+#pragma once
+
+// ===== C++ ================================================================
+#include <vector>
+
+// The PerfectHash places each name in its own slot using the "hash,
+// displace and compress" method. The names are first distributed into
+// buckets. Then, from the largest bucket to the smallest, a seed placing
+// all the names of the bucket into free slots is searched. There are as
+// many slots as names, so a lookup needs two hashes and one comparison.
+//
+// The generated headers contain the same hash function, so the tables
+// built here are used at compile time.
+class PerfectHash
+{
+
+public:
+
+    static const unsigned int NO_NAME;
+
+    // 32 bits FNV-1a, the seed modifies the offset basis
+    static uint32_t Hash(const char* aName, uint32_t aSeed);
+
+    // aNames  The names must stay valid until the next Build
+    //
+    // Exception  RESULT_INVALID_CONFIG  Duplicated name
+    void Build(const std::vector<const char*>& aNames);
+
+    // Return  The index of the name, or NO_NAME
+    unsigned int Find(const char* aName) const;
+
+    unsigned int GetBucketCount() const;
+
+    // The seeds, one per bucket
+    const std::vector<uint32_t>& GetSeeds() const;
+
+    // The index of the name in each slot
+    const std::vector<unsigned int>& GetSlots() const;
+
+private:
+
+    bool Place(const std::vector<unsigned int>& aBucket, uint32_t aSeed, std::vector<unsigned int>* aPlaced);
+
+    std::vector<const char*> mNames;
+
+    std::vector<uint32_t>     mSeeds;
+    std::vector<unsigned int> mSlots;
+
+};
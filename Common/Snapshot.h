@@ -0,0 +1,95 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      Common/Snapshot.h
+// Status    DEV
+
+#pragma once
+
+// ===== C++ ================================================================
+#include <string>
+#include <vector>
+
+// ===== Import/Includes ====================================================
+#include <KMS/File/Folder.h>
+
+// A snapshot contains the objects the parse of the files of a project
+// produced. The values are written in the order the lists read them back,
+// so the snapshot contains no field name and no separator.
+class SnapshotWriter
+{
+
+public:
+
+    SnapshotWriter(std::vector<uint8_t>* aOut);
+
+    void Add_Data(const void* aIn, unsigned int aSize_byte);
+
+    void Add_String(const char* aString);
+
+    void Add_UInt(unsigned int aValue);
+
+    void Add_WString(const std::wstring& aString);
+
+private:
+
+    NO_COPY(SnapshotWriter);
+
+    std::vector<uint8_t>* mOut;
+
+};
+
+class SnapshotReader
+{
+
+public:
+
+    // aData  The data must stay valid while the strings are used
+    SnapshotReader(const uint8_t* aData, unsigned int aSize_byte);
+
+    unsigned int GetOffset_byte() const;
+
+    bool IsAtEnd() const;
+
+    // Return  The data inside the snapshot, it is not aligned
+    //
+    // Exception  RESULT_INVALID_FORMAT
+    const uint8_t* Get_Data(unsigned int aSize_byte);
+
+    // Return  A string inside the data, the caller copies it
+    //
+    // Exception  RESULT_INVALID_FORMAT
+    const char* Get_String();
+
+    // Exception  RESULT_INVALID_FORMAT
+    unsigned int Get_UInt();
+
+    // Exception  RESULT_INVALID_FORMAT
+    std::wstring Get_WString();
+
+private:
+
+    NO_COPY(SnapshotReader);
+
+    void Verify(unsigned int aSize_byte) const;
+
+    const uint8_t* mData;
+    unsigned int   mOffset_byte;
+    unsigned int   mSize_byte;
+
+};
+
+// The header of the file contains a hash of the key, of the version of the
+// tool and of the data. The key identifies the files the snapshot
+// replaces, usually the hash and the size of their content.
+//
+// aOut  The data, without the header
+//
+// Return  false when the file does not exist or does not correspond to the
+//         key or to this version of the tool
+extern bool Snapshot_Read(const KMS::File::Folder& aFolder, const char* aFileName, const uint64_t* aKey, unsigned int aKeyCount, std::vector<uint8_t>* aOut);
+
+// Exception  RESULT_REPLACE_FAILED
+extern void Snapshot_Write(const KMS::File::Folder& aFolder, const char* aFileName, const uint64_t* aKey, unsigned int aKeyCount, const std::vector<uint8_t>& aData);
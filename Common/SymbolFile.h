@@ -0,0 +1,100 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      Common/SymbolFile.h
+// Status    DEV
+
+#pragma once
+
+// The symbol file contains the public addresses in a form the tools map in
+// memory and use without parsing. All the values are little endian and all
+// the offsets are from the beginning of the file.
+//
+// +--------------------+
+// | SymbolFile_Header  |
+// +--------------------+
+// | SymbolFile_Record  | Sorted by type, then by address, so the records of
+// | ...                | a type are contiguous
+// +--------------------+
+// | uint32_t           | Seeds, one per bucket
+// | ...                |
+// +--------------------+
+// | uint32_t           | Slots, the index of a record or SYMBOL_FILE_NO_RECORD
+// | ...                |
+// +--------------------+
+// | char               | String pool, null terminated names
+// | ...                |
+// +--------------------+
+//
+// Looking up a name
+//     Seed   = Seeds[Hash(Name, 0) % BucketCount]
+//     Record = Slots[Hash(Name, Seed) % SlotCount]
+// then compare the name of the record with Name. Hash is the 32 bits
+// FNV-1a where the seed modifies the offset basis
+//     Hash = 0x811c9dc5 ^ Seed
+//     For each byte: Hash = (Hash ^ Byte) * 0x01000193
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define SYMBOL_FILE_MAGIC   (0x4c4d5953) // SYML
+#define SYMBOL_FILE_VERSION (1)
+
+#define SYMBOL_FILE_NO_RECORD (0xffffffff)
+
+// Data types
+// //////////////////////////////////////////////////////////////////////////
+
+typedef enum
+{
+    SYMBOL_FILE_TYPE_COIL = 0,         // Modbus 1x
+    SYMBOL_FILE_TYPE_HOLDING_REGISTER, // Modbus 4x
+
+    SYMBOL_FILE_TYPE_QTY
+}
+SymbolFile_Type;
+
+typedef struct
+{
+    uint32_t mFirst;
+    uint32_t mCount;
+}
+SymbolFile_Range;
+
+typedef struct
+{
+    uint32_t mMagic;
+    uint16_t mVersion;
+    uint16_t mHeaderSize_byte;
+
+    uint32_t mRecordCount;
+    uint32_t mRecordOffset_byte;
+
+    // The records of each type, indexed using SymbolFile_Type
+    SymbolFile_Range mTypes[SYMBOL_FILE_TYPE_QTY];
+
+    uint32_t mBucketCount;
+    uint32_t mSeedOffset_byte;
+
+    uint32_t mSlotCount;
+    uint32_t mSlotOffset_byte;
+
+    uint32_t mStringOffset_byte;
+    uint32_t mStringSize_byte;
+}
+SymbolFile_Header;
+
+typedef struct
+{
+    uint32_t mNameOffset_byte;
+    uint16_t mNameLength;
+    uint16_t mAddress;
+    uint8_t  mType;
+    uint8_t  mReserved0[3];
+}
+SymbolFile_Record;
+
+static_assert(56 == sizeof(SymbolFile_Header), "Invalid SymbolFile_Header size");
+static_assert(12 == sizeof(SymbolFile_Record), "Invalid SymbolFile_Record size");
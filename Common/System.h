@@ -21,8 +21,15 @@ class System : public KMS::CLI::Tool
 
 public:
 
+    static const char* DEP_FILE_DEFAULT;
+
+    static const unsigned int PROJECT_EBPRO;
+    static const unsigned int PROJECT_TRILOGI;
+
     static int Main(int aCount, const char** aVector);
 
+    KMS::DI::String_Expand mDepFile;
+
     System();
 
     void Clean();
@@ -35,12 +42,23 @@ public:
 
     void Import();
 
-    void Read();
-
-    void Parse();
+    // Read and parse the projects not already loaded. Each command loads
+    // only the projects it uses.
+    //
+    // aProjects  PROJECT_EBPRO and/or PROJECT_TRILOGI
+    void Load(unsigned int aProjects);
 
     void Program_PLC();
 
+    // Import the sources, which give the public addresses, when no command
+    // already imported them, then relocate the public words
+    void Relocate_Words();
+
+    void Report_ScanTime();
+
+    // aDelta  See TRiLOGI::Project::Restore
+    void Restore_PC6(const char* aDelta);
+
     void Verify();
 
     void Write();
@@ -54,20 +72,28 @@ private:
 
     NO_COPY(System);
 
-    int Cmd_Clean      (KMS::CLI::CommandLine* aCmd);
-    int Cmd_Edit       (KMS::CLI::CommandLine* aCmd);
-    int Cmd_Edit_emtp  (KMS::CLI::CommandLine* aCmd);
-    int Cmd_Edit_PC6   (KMS::CLI::CommandLine* aCmd);
-    int Cmd_Export     (KMS::CLI::CommandLine* aCmd);
-    int Cmd_Import     (KMS::CLI::CommandLine* aCmd);
-    int Cmd_Program    (KMS::CLI::CommandLine* aCmd);
-    int Cmd_Program_PLC(KMS::CLI::CommandLine* aCmd);
-    int Cmd_Verify     (KMS::CLI::CommandLine* aCmd);
-    int Cmd_Write      (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Clean          (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Edit           (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Edit_emtp      (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Edit_PC6       (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Export         (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Import         (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Program        (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Program_PLC    (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Relocate       (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Relocate_Words (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Report         (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Report_ScanTime(KMS::CLI::CommandLine* aCmd);
+    int Cmd_Restore        (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Restore_PC6    (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Verify         (KMS::CLI::CommandLine* aCmd);
+    int Cmd_Write          (KMS::CLI::CommandLine* aCmd);
 
     EBPro::Project   mEBPro;
     TRiLOGI::Project mTRiLOGI;
 
     KMS::CLI::Macros mMacros;
 
+    unsigned int mLoaded;
+
 };
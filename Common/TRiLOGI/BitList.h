@@ -14,20 +14,22 @@
 // ===== Local ==============================================================
 #include "../Address.h"
 #include "../AddressList.h"
+#include "../PatternSet.h"
 
 #include "ObjectList.h"
 
 namespace TRiLOGI
 {
 
-    class BitList : public ObjectList
+    class BitList : public TypedList<BitList, Object>
     {
 
     public:
 
-        BitList(const char* aElementName, unsigned int aStartAddress, unsigned int aMaxQty);
+        BitList(const char* aElementName, SymbolKind aKind, unsigned int aStartAddress, unsigned int aMaxQty);
 
-        void GetAddresses(const std::regex& aRegEx, AddressList* aOut) const;
+        // aOut  One list for each expression of aPatterns
+        void GetAddresses(PatternSet* aPatterns, std::vector<AddressList>* aOut) const;
 
         void Display_ByName (FILE* aOut, unsigned int aModbusBaseAddress) const;
         void Display_ByIndex(FILE* aOut, unsigned int aModbusBaseAddress) const;
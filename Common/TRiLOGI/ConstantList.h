@@ -9,14 +9,14 @@
 #pragma once
 
 // ===== C++ ================================================================
-#include <map>
-#include <string>
+#include <vector>
 
 namespace TRiLOGI
 {
 
     class Constant;
 
+    // The DefineList verifies the constant names using the symbol table.
     class ConstantList
     {
 
@@ -34,9 +34,7 @@ namespace TRiLOGI
 
     private:
 
-        typedef std::map<std::string, Constant*> ByName;
-
-        ByName mConstants_ByName;
+        std::vector<Constant*> mConstants;
 
     };
 
@@ -14,7 +14,9 @@
 namespace TRiLOGI
 {
 
-    class CounterList : public ObjectList
+    class Counter;
+
+    class CounterList : public TypedList<CounterList, Counter>
     {
 
     public:
@@ -28,8 +30,11 @@ namespace TRiLOGI
 
     protected:
 
-        // ===== ObjectList =================================================
-        virtual void AddObject(const wchar_t* aLine, unsigned int aFlags);
+        friend class TypedList<CounterList, Counter>;
+
+        void ParseLine(const wchar_t* aLine, unsigned int aFlags);
+
+        void ReadSnapshotRecord(SnapshotReader* aReader, unsigned int aFlags);
 
     private:
 
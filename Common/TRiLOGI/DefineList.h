@@ -16,7 +16,9 @@
 namespace TRiLOGI
 {
 
-    class DefineList : public ObjectList
+    // The defines are constants and words. Each one uses the symbol slot of
+    // its kind, so the slot gives its type.
+    class DefineList : public TypedList<DefineList, Object>
     {
 
     public:
@@ -25,17 +27,27 @@ namespace TRiLOGI
 
         void ClearList();
 
+        // The words are also removed from mWords
+        unsigned int Clean();
+
+        void DisplayStats() const;
+
         void Display_ByIndex(FILE* aOut) const;
         void Display_ByName (FILE* aOut) const;
 
+        Object* FindObject_ByName(const char* aName);
+
         bool ImportConstant(const char* aName, const char* aValue);
 
         bool ImportWord(const char* aName);
         bool ImportWord(const char* aName, unsigned int aOffset);
 
-        unsigned int Parse(KMS::Text::File_UTF16* aFile_PC6, unsigned int aLineNo);
+        void Parse(const File_PC6& aFile_PC6, unsigned int aFirst, unsigned int aEnd);
 
-        void Verify(const KMS::Text::File_UTF16& aFile_PC6, const AddressList* aPublicAddresses);
+        // See WordList::Relocate
+        bool RelocateWords(const std::vector<unsigned int>& aOffsets, WordRelocation* aRelocation);
+
+        void Verify(const UsageCounter& aUsage, const AddressList* aPublicAddresses);
 
         WordList mWords;
 
@@ -44,13 +56,22 @@ namespace TRiLOGI
 
     protected:
 
-        // ===== ObjectList =================================================
-        virtual void AddObject(const wchar_t* aLine, unsigned int aFlags);
+        friend class TypedList<DefineList, Object>;
+
+        void ParseLine(const wchar_t* aLine, unsigned int aFlags);
+
+        // Exception  RESULT_INVALID_FORMAT
+        void ReadSnapshotRecord(SnapshotReader* aReader, unsigned int aFlags);
 
     private:
 
         NO_COPY(DefineList);
 
+        void AddDefine(Constant* aConstant);
+        void AddDefine(Word    * aWord);
+
+        void VerifyName(const Object* aObject, SymbolKind aOther);
+
         ConstantList mConstants;
 
     };
@@ -0,0 +1,128 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      Common/TRiLOGI/File_PC6.h
+// Status    DEV
+
+#pragma once
+
+// ===== C++ ================================================================
+#include <vector>
+
+// ===== Import/Includes ====================================================
+#include <KMS/File/Folder.h>
+
+// ===== Local ==============================================================
+#include "../Arena.h"
+#include "../Snapshot.h"
+
+namespace TRiLOGI
+{
+
+    // A PC6 file is UTF-16 big endian with a byte order mark. Read maps the
+    // file and decodes it in a single buffer. Each line is a view into this
+    // buffer, so reading does not allocate memory for each line.
+    //
+    // Clear only forgets the lines. The buffer stays valid until the next
+    // Read or Compact, so the LineList keep their views while BuildFile rebuilds the
+    // file. The lines preceding the last Clear also stay valid, so BuildFile
+    // adds the unchanged sections back using AddLines_Previous.
+    class File_PC6
+    {
+
+    public:
+
+        File_PC6();
+
+        void Clear();
+
+        const wchar_t* GetLine(unsigned int aLineNo) const;
+
+        unsigned int GetLineCount() const;
+
+        // The hash and the size of the content read or written last
+        uint64_t     GetHash     () const;
+        unsigned int GetSize_byte() const;
+
+        // The line is copied
+        void AddLine(const wchar_t* aLine);
+
+        // The line is copied, except when it is in the buffer Read
+        // decoded. A line of the previous content, which the next Clear may
+        // release, stays valid in the file.
+        void AddLine_Keep(const wchar_t* aLine);
+
+        // The line is not copied. It must be a line of this file or a
+        // constant.
+        void AddLine_View(const wchar_t* aLine);
+
+        // The caller writes the line, its null character included, in the
+        // returned space, then gives its length to AddLine_End. Nothing else
+        // may be added between both calls. The RecordWriter uses these
+        // methods.
+        wchar_t* AddLine_Begin(unsigned int aMaxLength);
+        void     AddLine_End  (unsigned int aLength);
+
+        // Add the lines aFirst to aEnd - 1 of the content preceding the last
+        // Clear
+        void AddLines_Previous(unsigned int aFirst, unsigned int aEnd);
+
+        // Copy the lines referring to the buffer Read decoded, then release
+        // this buffer. The lines preceding the last Clear become invalid.
+        void Compact();
+
+        // Read releases the buffer the previous Read decoded and the lines
+        // preceding the last Clear. The caller clears the lists referring
+        // to these lines before calling it.
+        void Read(const KMS::File::Folder& aFolder, const char* aFileName);
+
+        // The hash and the size of the file, the file is not decoded
+        static uint64_t ReadHash(const KMS::File::Folder& aFolder, const char* aFileName, unsigned int* aSize_byte);
+
+        // Like Read, but the decoded buffer and the lines come from a
+        // snapshot. aHash and aSize_byte are those ReadHash returned.
+        //
+        // Exception  RESULT_INVALID_FORMAT
+        void ReadSnapshot(SnapshotReader* aReader, uint64_t aHash, unsigned int aSize_byte);
+
+        // The hash of the content read or written last tells if the file
+        // already contains the lines, without reading it again.
+        //
+        // aBackup  See Utl_ReplaceFile
+        //
+        // Return  false when the file already contains the lines
+        bool Write(const KMS::File::Folder& aFolder, const char* aFileName, const char* aBackup = nullptr);
+
+        // Return  false when the file already contains the lines
+        bool Write_ASCII(const KMS::File::Folder& aFolder, const char* aFileName) const;
+
+        // The lines must be the lines Read decoded
+        void WriteSnapshot(SnapshotWriter* aWriter) const;
+
+    private:
+
+        NO_COPY(File_PC6);
+
+        void Encode(std::vector<uint8_t>* aOut) const;
+
+        Arena* GetArena();
+
+        // Clear alternates between the two arenas, the other one contains
+        // the copied lines of the previous content.
+        Arena        mArenas[2];
+        unsigned int mArena;
+
+        std::vector<wchar_t> mData;
+
+        std::vector<const wchar_t*> mLines;
+        std::vector<const wchar_t*> mLines_Previous;
+
+        // The file read or written last
+        uint64_t     mFile_Hash;
+        unsigned int mFile_Size_byte;
+
+    };
+
+}
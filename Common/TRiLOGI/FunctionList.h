@@ -8,44 +8,67 @@
 
 #pragma once
 
-// ===== Import/Includes ====================================================
-#include <KMS/Text/File_ASCII.h>
-#include <KMS/Text/File_UTF16.h>
-
 // ===== Local ==============================================================
+#include "../Parser.h"
+
 #include "ObjectList.h"
 
 namespace TRiLOGI
 {
 
     class Function;
+    class Optimizer;
+    class WordRelocation;
 
-    class FunctionList : public ObjectList
+    class FunctionList : public TypedList<FunctionList, Function>
     {
 
     public:
 
         FunctionList();
 
+        void DisplayStats() const;
+
         void Display_ByIndex(FILE* aOut) const;
         void Display_ByName (FILE* aOut) const;
 
-        Function* Find_ByIndex(unsigned int aIndex);
-        Function* Find_ByName (const char* aName);
+        void AddCodeToFile(File_PC6* aFile_PC6);
+
+        // The CALL, HSCDEF and INTRDEF statements give the function number,
+        // which is the index plus one.
+        //
+        // aArg  The argument, a number or the name of a constant, followed
+        //       by the end of the statement
+        //
+        // Return  The function number, 0 when the argument is an expression
+        //         or a variable
+        unsigned int GetNumber(const char* aArg) const;
 
-        void AddCodeToFile(KMS::Text::File_UTF16* aFile_PC6);
+        // The Parser is positioned on the line following the FUNCTION
+        // statement. The Optimizer, when present, rewrites the code before
+        // it is compared with the existing function.
+        bool Import(const char* aName, Parser* aParser, Optimizer* aOptimizer);
 
-        bool Import(const char* aName, KMS::Text::File_ASCII* aFile, KMS::Text::File_ASCII::Internal::iterator* aIt);
+        void Parse_Code(const File_PC6& aFile_PC6, unsigned int aFirst, unsigned int aEnd);
+        void Parse_Name(const File_PC6& aFile_PC6, unsigned int aFirst, unsigned int aEnd);
 
-        unsigned int Parse_Code(KMS::Text::File_UTF16* aFile_PC6, unsigned int aLineNo);
-        unsigned int Parse_Name(KMS::Text::File_UTF16* aFile_PC6, unsigned int aLineNo);
+        // Return  The number of changed functions
+        unsigned int RelocateWords(WordRelocation* aRelocation);
 
-        void Verify(const KMS::Text::File_UTF16& aFile_PC6);
+        void Verify(const UsageCounter& aUsage);
+
+    protected:
+
+        friend class TypedList<FunctionList, Function>;
+
+        void ReadSnapshotRecord(SnapshotReader* aReader, unsigned int aFlags);
 
     private:
 
         NO_COPY(FunctionList);
 
+        Function* NewFunction(const Function& aFunction);
+
     };
 
 }
@@ -9,15 +9,23 @@
 #pragma once
 
 // ===== C++ ================================================================
-#include <list>
-#include <string>
+#include <vector>
 
-// ===== Import/Includes ====================================================
-#include <KMS/Text/File_UTF16.h>
+// ===== Local ==============================================================
+#include "../Arena.h"
+
+#include "File_PC6.h"
 
 namespace TRiLOGI
 {
 
+    class WordRelocation;
+
+    // The lines are views into the File_PC6 lines or constants. They are
+    // not copied, except the lines RelocateWords changes, which the
+    // LineList keeps until its destruction. Once compacted, the lines of
+    // the file are in an arena, so the LineList must parse the lines of
+    // each new content again.
     class LineList
     {
 
@@ -29,16 +37,31 @@ namespace TRiLOGI
 
         void AddLine(const wchar_t* aLine);
 
-        void AddToFile(KMS::Text::File_UTF16* aFile_PC6);
+        void AddToFile(File_PC6* aFile_PC6);
+
+        const wchar_t* GetLine(unsigned int aIndex) const;
+
+        unsigned int GetLineCount() const;
 
-        unsigned int Parse(KMS::Text::File_UTF16* aFile_PC6, unsigned int aLineNo, bool aUntilEnd);
+        void Parse(const File_PC6& aFile_PC6, unsigned int aFirst, unsigned int aEnd);
+
+        // Return  The number of changed lines
+        unsigned int RelocateWords(WordRelocation* aRelocation);
+
+        // See ObjectList::IsDirty
+        bool IsDirty() const;
+        void ClearDirty();
 
     private:
 
-        typedef std::list<std::wstring> Internal;
+        typedef std::vector<const wchar_t*> Internal;
 
         Internal mLines;
 
+        Arena mArena;
+
+        bool mDirty;
+
     };
 
 }
@@ -9,19 +9,24 @@
 #pragma once
 
 // ===== C++ ================================================================
-#include <map>
 #include <string>
-
-// ===== Import/Includes ====================================================
-#include <KMS/Text/File_UTF16.h>
+#include <vector>
 
 // ===== Local ==============================================================
 #include "../AddressList.h"
+#include "../Arena.h"
+#include "../Bitmap.h"
+#include "../Snapshot.h"
+
+#include "File_PC6.h"
+#include "SymbolTable.h"
 
 namespace TRiLOGI
 {
 
     class Object;
+    class Reachability;
+    class UsageCounter;
 
     class ObjectList
     {
@@ -30,11 +35,20 @@ namespace TRiLOGI
 
         ~ObjectList();
 
-        void AddToFile(KMS::Text::File_UTF16* aFile_PC6);
+        void AddNames(UsageCounter* aUsage) const;
+
+        void AddToFile(File_PC6* aFile_PC6);
         void ClearList();
 
+        // A list is dirty when its content differs from its section of the
+        // file. A new list is dirty because the file does not contain it.
+        bool IsDirty() const;
+        void ClearDirty();
+
         unsigned int GetCount() const;
 
+        void DisplayStats() const;
+
         const Object* FindObject_ByIndex(unsigned int aIndex) const;
 
         Object* FindObject_ByIndex(unsigned int aIndex);
@@ -45,33 +59,65 @@ namespace TRiLOGI
 
         unsigned int Clean();
 
-        unsigned int Parse(KMS::Text::File_UTF16* aFile_PC6, unsigned int aLineNo, unsigned int aFlags);
+        void Verify(const UsageCounter& aUsage, const AddressList* aPublicAddresses);
+
+        // Add FLAG_NOT_USED to the objects of kind aKind the analysis does
+        // not reach. The public addresses stay, the HMI uses them.
+        //
+        // Return  The number of objects not reached
+        unsigned int Verify_Reachability(const Reachability& aReachability, SymbolKind aKind, const AddressList* aPublicAddresses);
 
-        void Verify(const KMS::Text::File_UTF16& aFile_CP6, const AddressList* aPublicAddresses);
+        void WriteSnapshot(SnapshotWriter* aWriter) const;
 
         void SetProjectType(ProjectType aPT);
 
+        // By default, a list uses its own symbol table. The Project shares
+        // its table between all its lists.
+        void SetSymbolTable(SymbolTable* aSymbols);
+
     protected:
 
-        typedef std::map<unsigned int, Object*> ByIndex;
-        typedef std::map<std::string , Object*> ByName;
+        // The slots of ByIndex not marked in mUsed contain nullptr
+        typedef std::vector<Object*> ByIndex;
 
-        ObjectList(const char* aElementName, unsigned int aMaxQty);
+        // aKind  SymbolKind::QTY when the derived list gives the kind of
+        //        each object
+        ObjectList(const char* aElementName, unsigned int aMaxQty, SymbolKind aKind);
 
         const char* GetElementName() const;
 
         bool IsProjectLegacy() const;
 
         void AddObject(Object* aObject);
-
-        virtual void AddObject(const wchar_t* aLine, unsigned int aFlags);
+        void AddObject(Object* aObject, SymbolKind aKind);
 
         unsigned int FindFreeIndex();
 
+        Object* FindObject_ByName(const char* aName, SymbolKind aKind) const;
+
+        bool Insert_ByIndex(Object* aObject, unsigned int aIndex);
+        bool Insert_ByName (Object* aObject, SymbolKind aKind);
+
+        // TypedList::Parse calls the ParseLine method of the derived class
+        // without virtual dispatch. This one creates a plain Object.
+        void ParseLine(const wchar_t* aLine, unsigned int aFlags);
+
+        // TypedList::ReadSnapshot calls the ReadSnapshotRecord method of the
+        // derived class the same way.
+        void ReadSnapshotRecord(SnapshotReader* aReader, unsigned int aFlags);
+
+        // The object and a copy of its name are allocated in the arena of
+        // the list. ClearList destroys all of them at once.
+        template <typename T, typename... A>
+        T* NewObject(const char* aName, A&&... aArgs);
+
         void Replace(Object* aOld, Object* aNew);
 
+        void SetDirty();
+
+        Arena mArena;
+
         ByIndex mObjects_ByIndex;
-        ByName  mObjects_ByName;
 
     private:
 
@@ -79,10 +125,115 @@ namespace TRiLOGI
 
         const char   * mElementName;
 
+        unsigned int mCount;
+        bool         mDirty;
+        SymbolKind   mKind;
         unsigned int mMaxQty;
 
+        Bitmap mUsed;
+
         ProjectType mProjectType;
 
+        SymbolTable* mSymbols;
+        SymbolTable  mSymbols_Private;
+
+    };
+
+    // D  The derived list
+    // T  The type of the objects the list contains
+    //
+    // The list knows the type of its objects at compile time, so the
+    // lookups do not use dynamic_cast and the parsing of each line is a
+    // direct call the compiler can inline.
+    template <typename D, typename T>
+    class TypedList : public ObjectList
+    {
+
+    public:
+
+        T* Find_ByIndex(unsigned int aIndex);
+        T* Find_ByName (const char* aName);
+
+        // This method may be called from a worker thread. It must not
+        // display anything, the caller uses DisplayStats once the parsing
+        // is completed.
+        void Parse(const File_PC6& aFile_PC6, unsigned int aFirst, unsigned int aEnd, unsigned int aFlags);
+
+        // Exception  RESULT_INVALID_FORMAT
+        void ReadSnapshot(SnapshotReader* aReader, unsigned int aFlags);
+
+    protected:
+
+        TypedList(const char* aElementName, unsigned int aMaxQty, SymbolKind aKind);
+
+    private:
+
+        NO_COPY(TypedList);
+
     };
 
+    // Protected
+    // //////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename... A>
+    T* ObjectList::NewObject(const char* aName, A&&... aArgs)
+    {
+        return mArena.New<T>(mArena.Copy(aName), std::forward<A>(aArgs)...);
+    }
+
+    // Public
+    // //////////////////////////////////////////////////////////////////////
+
+    template <typename D, typename T>
+    T* TypedList<D, T>::Find_ByIndex(unsigned int aIndex)
+    {
+        return static_cast<T*>(FindObject_ByIndex(aIndex));
+    }
+
+    // The derived list may hide FindObject_ByName
+    template <typename D, typename T>
+    T* TypedList<D, T>::Find_ByName(const char* aName)
+    {
+        return static_cast<T*>(static_cast<D*>(this)->FindObject_ByName(aName));
+    }
+
+    template <typename D, typename T>
+    void TypedList<D, T>::Parse(const File_PC6& aFile_PC6, unsigned int aFirst, unsigned int aEnd, unsigned int aFlags)
+    {
+        assert(aFirst <= aEnd);
+
+        auto lThis = static_cast<D*>(this);
+
+        for (auto lLineNo = aFirst; lLineNo < aEnd; lLineNo++)
+        {
+            auto lLine = aFile_PC6.GetLine(lLineNo);
+            assert(nullptr != lLine);
+
+            lThis->ParseLine(lLine, aFlags);
+        }
+    }
+
+    template <typename D, typename T>
+    void TypedList<D, T>::ReadSnapshot(SnapshotReader* aReader, unsigned int aFlags)
+    {
+        assert(nullptr != aReader);
+
+        auto lThis = static_cast<D*>(this);
+
+        auto lCount = aReader->Get_UInt();
+
+        for (unsigned int i = 0; i < lCount; i++)
+        {
+            lThis->ReadSnapshotRecord(aReader, aFlags);
+        }
+    }
+
+    // Protected
+    // //////////////////////////////////////////////////////////////////////
+
+    template <typename D, typename T>
+    TypedList<D, T>::TypedList(const char* aElementName, unsigned int aMaxQty, SymbolKind aKind)
+        : ObjectList(aElementName, aMaxQty, aKind)
+    {}
+
 }
@@ -8,6 +8,11 @@
 
 #pragma once
 
+// ===== C++ ================================================================
+#include <ostream>
+#include <string>
+#include <vector>
+
 // ===== Import =============================================================
 #include <KMS/Callback.h>
 #include <KMS/DI/Array.h>
@@ -15,50 +20,75 @@
 #include <KMS/DI/Dictionary.h>
 #include <KMS/DI/Enum.h>
 #include <KMS/DI/String_Expand.h>
-#include <KMS/Text/File_UTF16.h>
 
 // ===== Local ==============================================================
+#include "../PatternSet.h"
+
 #include "BitList.h"
 #include "CounterList.h"
 #include "DefineList.h"
+#include "File_PC6.h"
 #include "FunctionList.h"
 #include "LineList.h"
+#include "ScanTime.h"
+#include "SectionIndex.h"
 #include "Software.h"
 #include "TimerList.h"
 
 namespace TRiLOGI
 {
 
+    class Optimizer;
+
     class Project : public KMS::DI::Dictionary
     {
 
     public:
 
+        static const bool        COMPACT_DEFAULT;
         static const char      * COMPILED_FILE_NAME_DEFAULT;
         static const bool        CREATE_IF_NEEDED_DEFAULT;
         static const char      * EXPORTED_DEFAULT;
         static const char      * FILE_NAME_DEFAULT;
         static const char      * HEADER_FILE_DEFAULT;
         static const char      * HEADER_PREFIX_DEFAULT;
+        static const HeaderType  HEADER_TYPE_DEFAULT;
         static const uint8_t     ID_DEFAULT;
         static const char      * IP_ADDRESS_DEFAULT;
+        static const bool        MINIFY_DEFAULT;
+        static const bool        OPTIMIZE_DEFAULT;
         static const ProjectType PROJECT_TYPE_DEFAULT;
+        static const char      * READABLE_FILE_DEFAULT;
+        static const char      * SNAPSHOT_FILE_DEFAULT;
+        static const char      * SYMBOL_FILE_DEFAULT;
         static const char      * TOOL_CONFIG_DEFAULT;
 
+        KMS::DI::Boolean                               mCompact;
         KMS::DI::String_Expand                         mCompiledFileName;
         KMS::DI::Boolean                               mCreateIfNeeded;
         KMS::DI::String_Expand                         mExported;
         KMS::DI::String_Expand                         mFileName;
         KMS::DI::String_Expand                         mHeaderFile;
         KMS::DI::String_Expand                         mHeaderPrefix;
+        KMS::DI::Enum<HeaderType, HEADER_TYPE_NAMES>   mHeaderType;
         KMS::DI::UInt<uint8_t>                         mId;
         KMS::DI::String_Expand                         mIPAddress;
+        KMS::DI::Boolean                               mMinify;
+        KMS::DI::Boolean                               mOptimize;
         KMS::DI::Enum<ProjectType, PROJECT_TYPE_NAMES> mProjectType;
+        KMS::DI::String_Expand                         mReadableFile;
+        KMS::DI::String_Expand                         mSnapshotFile;
+        ScanTime                                       mScanTime;
         KMS::DI::Array                                 mSources;
+        KMS::DI::String_Expand                         mSymbolFile;
         KMS::DI::String_Expand                         mToolConfig;
 
         Project();
 
+        // Return  true when Import added the public addresses of the
+        //         sources
+        bool IsImported() const;
+
         bool IsValid() const;
 
         void Clean();
@@ -75,6 +105,23 @@ namespace TRiLOGI
 
         void Read();
 
+        // Give consecutive offsets to the public words, in the order of
+        // the public addresses, so the HMI reads them using few Modbus
+        // requests. The DM[n] accesses of the circuits and of the
+        // functions, the header file and the tool configuration follow.
+        // Import must have added the public addresses.
+        void Relocate_Words();
+
+        // Exception  RESULT_SCAN_TIME_BUDGET  The estimated scan time exceeds
+        //                                     ScanTime.Budget
+        void Report_ScanTime();
+
+        // Write the version of the file a delta of its backup gives, then
+        // read and parse it. The current content becomes the backup.
+        //
+        // aDelta  See Utl_Delta_Restore
+        void Restore(const char* aDelta);
+
         void Verify();
 
         bool VerifyAddress_1X(uint16_t aAddr) const;
@@ -92,21 +139,44 @@ namespace TRiLOGI
         NO_COPY(Project);
 
         void AddPublicAddress(const char* aPrivate, const char* aPublic);
-        void AddPublicAddresses(const char* aRegEx);
+        void AddPublicAddresses();
 
         void BuildFile();
+        void BuildSection(SectionId aId, File_PC6* aFile_PC6);
+
+        void ClearDirty();
+
+        // Remove the sections the objects contain from the file. Only the
+        // sections of the line lists stay.
+        void Compact();
 
         void Create();
 
         void Export_HeaderFile();
+        void Export_HeaderFile_Constexpr(std::ostream& aOut, const char* aPrefix) const;
+        void Export_SymbolFile();
         void Export_ToolConfig();
 
-        bool Import_Source(const char* aFileName);
+        // aOptimizer  nullptr when the functions are neither optimized nor
+        //             minified
+        bool Import_Source(const char* aFileName, Optimizer* aOptimizer);
 
         void Parse_Legacy();
+        void Parse_Legacy_Full();
+
+        // Make the line lists refer to the lines of the file
+        void Parse_LineLists();
         void Parse_New();
 
-        unsigned int ParseNothing(unsigned int aLineNo, unsigned int aSectionCount);
+        // Read uses the snapshot to load the lines of the file, without
+        // decoding it. Parse_Legacy then uses ReadSnapshot_Lists to load the
+        // objects.
+        //
+        // Return  false when the snapshot does not exist or when it does not
+        //         correspond to the file and to this version of the tool
+        bool ReadSnapshot();
+        void ReadSnapshot_Lists();
+        void WriteSnapshot() const;
 
         void Reparse();
 
@@ -116,13 +186,45 @@ namespace TRiLOGI
         void Verify_Inputs    () const;
         void Verify_Outputs   () const;
 
+        // The functions, the relays and the words no ladder circuit reaches
+        // receive FLAG_NOT_USED, so Clean removes them.
+        void Verify_Reachability();
+
         void Verify_BitList(const BitList& aBits) const;
 
         // ===== Callbacks ==================================================
         const KMS::Callback<Project> ON_PROJECT_TYPE_CHANGED;
         unsigned int OnProjectTypeChanged(void* aSender, void* aData);
 
-        KMS::Text::File_UTF16 mFile;
+        // An ADDRESSES statement has no private name, its public name is
+        // the expression.
+        typedef struct
+        {
+            std::string  mPrivate;
+            std::string  mPublic;
+            unsigned int mPattern;
+        }
+        AddressStatement;
+
+        // The ADDRESS and ADDRESSES statements of the sources are applied
+        // once all the sources are imported.
+        std::vector<AddressStatement> mAddressStatements;
+
+        PatternSet mPatterns;
+
+        File_PC6 mFile;
+
+        // true when the file no longer contains the sections of the
+        // objects, BuildFile formats them again
+        bool mCompacted;
+
+        // true when Import added the public addresses of the sources
+        bool mImported;
+
+        // The snapshot Read loaded the file from. The objects start at
+        // mSnapshot_Offset_byte.
+        std::vector<uint8_t> mSnapshot;
+        unsigned int         mSnapshot_Offset_byte;
 
         LineList      mCircuits;
         CounterList   mCounters;
@@ -134,7 +236,9 @@ namespace TRiLOGI
         AddressList   mPublicAddresses;
         LineList      mQuickTags;
         BitList       mRelays;
+        SectionIndex  mSections;
         Software      mSoftware;
+        SymbolTable   mSymbols;
         TimerList     mTimers;
 
     };
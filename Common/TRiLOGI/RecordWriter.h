@@ -0,0 +1,60 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      Common/TRiLOGI/RecordWriter.h
+// Status    DEV
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "File_PC6.h"
+
+namespace TRiLOGI
+{
+
+    // The RecordWriter formats the lines of a PC6 file directly in the
+    // memory of the File_PC6. It does not use printf and it does not
+    // allocate memory for each line. Like the stack buffers it replaces, a
+    // line contains at most LINE_LENGTH characters, the null character
+    // included.
+    class RecordWriter
+    {
+
+    public:
+
+        RecordWriter(File_PC6* aFile_PC6);
+
+        void Begin();
+
+        void End();
+
+        void Add(wchar_t aC);
+
+        // The characters of a narrow string are widened one by one, as
+        // swprintf does for %S in the "C" locale.
+        void Add(const char* aString);
+
+        void Add(const wchar_t* aString);
+
+        void Add_UInt(unsigned int aValue);
+
+        // Exception  RESULT_INVALID_FORMAT
+        void Add_UTF8(const char* aString);
+
+    private:
+
+        NO_COPY(RecordWriter);
+
+        // Exception  RESULT_LINE_TOO_LONG
+        void Verify(unsigned int aLength);
+
+        File_PC6* mFile_PC6;
+
+        wchar_t* mBegin;
+        wchar_t* mPtr;
+
+    };
+
+}
@@ -0,0 +1,105 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      Common/TRiLOGI/ScanTime.h
+// Status    DEV
+
+#pragma once
+
+// ===== C++ ================================================================
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// ===== Import =============================================================
+#include <KMS/DI/Array.h>
+#include <KMS/DI/Dictionary.h>
+#include <KMS/DI/UInt.h>
+
+namespace TRiLOGI
+{
+
+    class Function;
+    class FunctionList;
+    class LineList;
+    class SymbolTable;
+
+    // The ScanTime estimates the worst case scan time of the ladder
+    // circuits and of the custom functions from a table of costs, in
+    // microseconds. It does not execute anything, the result is only as
+    // good as the costs the configuration gives.
+    //
+    // - A circuit costs Circuit, plus Contact for each contact and Coil.
+    //   A CusFn coil adds the cost of its function.
+    // - Each TBASIC statement costs Statement, unless Statements gives the
+    //   cost of its keyword ("Statements += SETLCD:500").
+    // - An IF block costs its condition plus its most expensive branch.
+    // - A FOR loop with constant bounds executes its count of iterations,
+    //   a WHILE loop and a FOR loop without constant bounds execute
+    //   LoopIterations iterations.
+    // - A CALL adds the cost of the called function, or of the most
+    //   expensive one when an expression or a variable gives its number.
+    //   A recursive call adds nothing.
+    class ScanTime : public KMS::DI::Dictionary
+    {
+
+    public:
+
+        static const uint32_t BUDGET_DEFAULT;
+        static const uint32_t CIRCUIT_DEFAULT;
+        static const uint32_t COIL_DEFAULT;
+        static const uint32_t CONTACT_DEFAULT;
+        static const uint32_t CUSFN_DEFAULT;
+        static const uint32_t LOOP_ITERATIONS_DEFAULT;
+        static const uint32_t STATEMENT_DEFAULT;
+
+        // 0 means no budget
+        KMS::DI::UInt<uint32_t> mBudget_us;
+
+        KMS::DI::UInt<uint32_t> mCircuit_us;
+        KMS::DI::UInt<uint32_t> mCoil_us;
+        KMS::DI::UInt<uint32_t> mContact_us;
+        KMS::DI::UInt<uint32_t> mCusFn_us;
+        KMS::DI::UInt<uint32_t> mLoopIterations;
+        KMS::DI::UInt<uint32_t> mStatement_us;
+        KMS::DI::Array          mStatements;
+
+        ScanTime();
+
+        // Write the estimated time of each circuit and of each function
+        //
+        // Return  The estimated worst case scan time, in microseconds
+        uint64_t Report(std::ostream& aOut, const SymbolTable& aSymbols, const LineList& aCircuits, FunctionList* aFunctions);
+
+        // ===== DI::Container ==============================================
+        void Validate() const;
+
+    private:
+
+        NO_COPY(ScanTime);
+
+        uint64_t GetCost(const char* aKeyword) const;
+
+        uint64_t Estimate_AnyFunction();
+        uint64_t Estimate_Block      (const Function& aFunction, unsigned int* aLine, const char* aEnd0, const char* aEnd1);
+        uint64_t Estimate_Circuit    (const wchar_t* aLine);
+        uint64_t Estimate_Function   (Function* aFunction);
+
+        typedef std::map<std::string, uint64_t> CostMap;
+
+        CostMap mCosts;
+
+        unsigned int mCycle;
+
+        std::map<const Function*, uint64_t> mFunctions_Done;
+        std::vector<const Function*>        mFunctions_InProgress;
+
+        FunctionList     * mFunctions;
+        const SymbolTable* mSymbols;
+
+    };
+
+}
@@ -0,0 +1,68 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      Common/TRiLOGI/SectionIndex.h
+// Status    DEV
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "File_PC6.h"
+
+namespace TRiLOGI
+{
+
+    enum class SectionId
+    {
+        INPUTS = 0,
+        OUTPUTS,
+        RELAYS,
+        TIMERS,
+        COUNTERS,
+        CIRCUITS,
+        FUNCTIONS,
+        FUNCTION_NAMES,
+        QUICK_TAGS,
+        DEFINES,
+        FOOTER,
+
+        QTY
+    };
+
+    // The SectionIndex locates all the sections of a PC6 file in a single
+    // pass. The first line of a section follows the terminator of the
+    // previous one and the end of a section is its terminator line. The
+    // footer has no terminator, it ends with the file.
+    class SectionIndex
+    {
+
+    public:
+
+        SectionIndex();
+
+        void Build(const File_PC6& aFile_PC6);
+
+        void Clear();
+
+        unsigned int GetEnd  (SectionId aId) const;
+        unsigned int GetFirst(SectionId aId) const;
+
+        // Return  false before the first Build and after Clear
+        bool IsValid() const;
+
+        // BuildFile gives the location of each section it adds
+        void Set(SectionId aId, unsigned int aFirst, unsigned int aEnd);
+
+    private:
+
+        NO_COPY(SectionIndex);
+
+        unsigned int mEnd  [static_cast<unsigned int>(SectionId::QTY)];
+        unsigned int mFirst[static_cast<unsigned int>(SectionId::QTY)];
+        bool         mValid;
+
+    };
+
+}
@@ -0,0 +1,115 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      Common/TRiLOGI/SymbolTable.h
+// Status    DEV
+
+#pragma once
+
+// ===== C++ ================================================================
+#include <mutex>
+#include <unordered_map>
+
+namespace TRiLOGI
+{
+
+    class Object;
+
+    enum class SymbolKind
+    {
+        INPUT = 0,
+        OUTPUT,
+        RELAY,
+        TIMER,
+        COUNTER,
+        FUNCTION,
+        CONSTANT,
+        WORD,
+
+        QTY
+    };
+
+    class Symbol
+    {
+
+    public:
+
+        Symbol();
+
+        Object* GetObject(SymbolKind aKind) const;
+
+        Object* mObjects[static_cast<unsigned int>(SymbolKind::QTY)];
+
+    };
+
+    // The SymbolTable is shared by all the object lists of a project. A
+    // name may designate one object of each kind. The table does not copy
+    // the names, its key is the name one of the objects of the symbol
+    // contains.
+    //
+    // The kind of the slot also gives the type of the object, so the lists
+    // use static_cast where they used dynamic_cast.
+    //
+    // The methods lock the table only between BeginParallel and
+    // EndParallel, while the sections are parsed in parallel.
+    class SymbolTable
+    {
+
+    public:
+
+        SymbolTable();
+
+        void BeginParallel();
+        void EndParallel  ();
+
+        void Clear();
+
+        const Symbol* Find(const char* aName) const;
+
+        Object* Find(const char* aName, SymbolKind aKind) const;
+
+        unsigned int GetCount() const;
+
+        // Return  false when the name already designates an object of the
+        //         same kind
+        bool Insert(SymbolKind aKind, Object* aObject);
+
+        void Remove(const Object* aObject);
+
+        void Replace(SymbolKind aKind, Object* aObject);
+
+    private:
+
+        NO_COPY(SymbolTable);
+
+        class NameEqual
+        {
+        public:
+            bool operator () (const char* aA, const char* aB) const;
+        };
+
+        class NameHash
+        {
+        public:
+            size_t operator () (const char* aName) const;
+        };
+
+        typedef std::unordered_map<const char*, Symbol, NameHash, NameEqual> SymbolMap;
+
+        std::unique_lock<std::mutex> Lock() const;
+
+        // The key must stay the name of one of the objects of the symbol.
+        // The symbol without object is removed.
+        void UpdateKey(SymbolMap::iterator aIt);
+
+        mutable std::mutex mMutex;
+
+        bool mParallel;
+
+        SymbolMap mSymbols;
+
+    };
+
+}
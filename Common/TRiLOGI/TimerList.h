@@ -14,7 +14,9 @@
 namespace TRiLOGI
 {
 
-    class TimerList : public ObjectList
+    class Timer;
+
+    class TimerList : public TypedList<TimerList, Timer>
     {
 
     public:
@@ -28,8 +30,11 @@ namespace TRiLOGI
 
     protected:
 
-        // ===== ObjectList =================================================
-        virtual void AddObject(const wchar_t* aLine, unsigned int aFlags);
+        friend class TypedList<TimerList, Timer>;
+
+        void ParseLine(const wchar_t* aLine, unsigned int aFlags);
+
+        void ReadSnapshotRecord(SnapshotReader* aReader, unsigned int aFlags);
 
     private:
 
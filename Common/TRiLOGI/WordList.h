@@ -10,7 +10,7 @@
 
 // ===== C++ ================================================================
 #include <map>
-#include <regex>
+#include <vector>
 #include <string>
 
 // ===== Import =============================================================
@@ -20,13 +20,17 @@
 // ===== Local ==============================================================
 #include "../Address.h"
 #include "../AddressList.h"
+#include "../Bitmap.h"
+#include "../PatternSet.h"
 
 namespace TRiLOGI
 {
 
     class Object;
     class Word;
+    class WordRelocation;
 
+    // The DefineList verifies the word names using the symbol table.
     class WordList : public KMS::DI::Dictionary
     {
 
@@ -45,13 +49,14 @@ namespace TRiLOGI
 
         WordList();
 
-        TRiLOGI::Object* AddWord(const char* aName, unsigned int aIndex, const char* aComment);
-
         void AddWord(Word* aWord);
 
         void ClearList();
 
-        void GetAddresses(const std::regex& aRegEx, AddressList* aOut) const;
+        void RemoveWord(const Word* aWord);
+
+        // aOut  One list for each expression of aPatterns
+        void GetAddresses(PatternSet* aPatterns, std::vector<AddressList>* aOut) const;
 
         unsigned int GetCount() const;
 
@@ -60,6 +65,27 @@ namespace TRiLOGI
 
         const Word* Find_ByOffset(unsigned int aOffset) const;
 
+        // Reserve aCount consecutive offsets, in the allocation direction of
+        // the project type. The caller then adds the words using
+        // AddWord(Word*), which marks each offset used once the word is
+        // inserted. An offset whose AddWord fails stays free. No other word
+        // may be added before.
+        //
+        // Return  The first reserved offset
+        //
+        // Exception  RESULT_TOO_MANY  No range is large enough
+        unsigned int ReserveOffsets(unsigned int aCount);
+
+        // Give consecutive offsets to the words at aOffsets, in this order.
+        // The offsets they leave are available for the new range, which is
+        // reserved like the offsets of new words.
+        //
+        // Return  false when the words already use consecutive offsets
+        //
+        // Exception  RESULT_TOO_MANY  No range is large enough, the words
+        //                             keep their offsets
+        bool Relocate(const std::vector<unsigned int>& aOffsets, WordRelocation* aRelocation);
+
         void SetProjectType(ProjectType aPT);
 
         // ===== DI::Container ==============================================
@@ -67,17 +93,17 @@ namespace TRiLOGI
 
     private:
 
-        typedef std::map<std::string , Word*> ByName;
         typedef std::map<unsigned int, Word*> ByOffset;
 
         NO_COPY(WordList);
 
-        unsigned int FindFreeOffset_Dec();
-        unsigned int FindFreeOffset_Inc();
+        unsigned int FindFreeOffset_Dec(unsigned int aCount);
+        unsigned int FindFreeOffset_Inc(unsigned int aCount);
 
         ProjectType mProjectType;
 
-        ByName   mWords_ByName;
+        Bitmap mUsed;
+
         ByOffset mWords_ByOffset;
 
     };
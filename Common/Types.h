@@ -27,6 +27,14 @@ enum class AddressType
     QTY
 };
 
+enum class HeaderType
+{
+    DEFINE = 0,
+    CONSTEXPR,
+
+    QTY
+};
+
 enum class ProjectType
 {
     LEGACY = 0,
@@ -39,4 +47,5 @@ enum class ProjectType
 // //////////////////////////////////////////////////////////////////////////
 
 extern const char* ADDRESS_TYPE_NAMES[];
+extern const char* HEADER_TYPE_NAMES[];
 extern const char* PROJECT_TYPE_NAMES[];
@@ -0,0 +1,64 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A-Test/PatternSet.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/PatternSet.h"
+
+using namespace KMS;
+
+KMS_TEST(PatternSet_Base, "Auto", sTest_Base)
+{
+    std::vector<unsigned int> lMatches;
+
+    // Constructor
+    PatternSet lPS;
+
+    // Match
+    lPS.Match("rA_Hrw", &lMatches);
+    KMS_TEST_ASSERT(lMatches.empty());
+
+    // Add
+    KMS_TEST_COMPARE(lPS.Add("^r.*_Hrw$"         ), 0U);
+    KMS_TEST_COMPARE(lPS.Add("i(Alarm|Motor)_\\w+"), 1U);
+    KMS_TEST_COMPARE(lPS.Add("[^i].*"            ), 2U);
+    KMS_TEST_COMPARE(lPS.Add("w(\\d)\\1"         ), 3U); // std::regex
+    KMS_TEST_COMPARE(lPS.Add("DoesNotExist"      ), 4U);
+
+    // GetCount
+    KMS_TEST_COMPARE(lPS.GetCount(), 5U);
+
+    // Match
+    lPS.Match("rA_Hrw", &lMatches);
+    KMS_TEST_COMPARE(lMatches.size(), 2U);
+    KMS_TEST_COMPARE(lMatches[0], 0U);
+    KMS_TEST_COMPARE(lMatches[1], 2U);
+
+    lPS.Match("rA_Hr", &lMatches);
+    KMS_TEST_COMPARE(lMatches.size(), 1U);
+    KMS_TEST_COMPARE(lMatches[0], 2U);
+
+    lPS.Match("iAlarm_Left", &lMatches);
+    KMS_TEST_COMPARE(lMatches.size(), 1U);
+    KMS_TEST_COMPARE(lMatches[0], 1U);
+
+    lPS.Match("iAlarm_", &lMatches);
+    KMS_TEST_ASSERT(lMatches.empty());
+
+    lPS.Match("w11", &lMatches);
+    KMS_TEST_COMPARE(lMatches.size(), 2U);
+    KMS_TEST_COMPARE(lMatches[0], 2U);
+    KMS_TEST_COMPARE(lMatches[1], 3U);
+
+    // Clear
+    lPS.Clear();
+    KMS_TEST_COMPARE(lPS.GetCount(), 0U);
+
+    lPS.Match("rA_Hrw", &lMatches);
+    KMS_TEST_ASSERT(lMatches.empty());
+}
@@ -0,0 +1,75 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A-Test/PerfectHash.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/PerfectHash.h"
+
+using namespace KMS;
+
+KMS_TEST(PerfectHash_Base, "Auto", sTest_Base)
+{
+    std::vector<const char*> lNames;
+
+    // Constructor
+    PerfectHash lPH;
+
+    // Build
+    lPH.Build(lNames);
+    KMS_TEST_COMPARE(lPH.GetBucketCount(), 1U);
+    KMS_TEST_COMPARE(lPH.GetSlots().size(), 1U);
+
+    // Find
+    KMS_TEST_COMPARE(lPH.Find("rA_Hrw"), PerfectHash::NO_NAME);
+
+    // Build
+    lNames.push_back("iAlarm_Left");
+    lNames.push_back("iAlarm_Right");
+    lNames.push_back("oMotor");
+    lNames.push_back("rA_Hrw");
+    lNames.push_back("rB_Hrw");
+    lNames.push_back("wSpeed");
+    lNames.push_back("wTemperature");
+
+    lPH.Build(lNames);
+    KMS_TEST_COMPARE(lPH.GetBucketCount(), 2U);
+    KMS_TEST_COMPARE(lPH.GetSeeds().size(), 2U);
+    KMS_TEST_COMPARE(lPH.GetSlots().size(), 7U);
+
+    // Find
+    for (unsigned int i = 0; i < lNames.size(); i++)
+    {
+        KMS_TEST_COMPARE(lPH.Find(lNames[i]), i);
+    }
+
+    KMS_TEST_COMPARE(lPH.Find("rC_Hrw"), PerfectHash::NO_NAME);
+    KMS_TEST_COMPARE(lPH.Find(""      ), PerfectHash::NO_NAME);
+
+    // Hash
+    KMS_TEST_COMPARE(PerfectHash::Hash("", 0), 0x811c9dc5U);
+    KMS_TEST_COMPARE(PerfectHash::Hash("a", 0), 0xe40c292cU);
+}
+
+KMS_TEST(PerfectHash_Exception, "Auto", sTest_Exception)
+{
+    std::vector<const char*> lNames;
+
+    lNames.push_back("rA_Hrw");
+    lNames.push_back("rB_Hrw");
+    lNames.push_back("rA_Hrw");
+
+    PerfectHash lPH;
+
+    // Build
+    try
+    {
+        lPH.Build(lNames);
+        KMS_TEST_ASSERT(false);
+    }
+    KMS_TEST_CATCH(RESULT_INVALID_CONFIG)
+}
@@ -0,0 +1,96 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A-Test/Snapshot.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/Snapshot.h"
+#include "../Common/TRiLOGI/File_PC6.h"
+
+using namespace KMS;
+
+KMS_TEST(Snapshot_Base, "Auto", sTest_Base)
+{
+    const uint8_t DATA[3] = { 1, 2, 3 };
+
+    std::vector<uint8_t> lData;
+
+    SnapshotWriter lW(&lData);
+
+    // Add_...
+    lW.Add_UInt   (0x12345678);
+    lW.Add_String ("Test");
+    lW.Add_WString(L"\u00c9tat");
+    lW.Add_WString(L"");
+    lW.Add_Data   (DATA, sizeof(DATA));
+
+    // Get_... - The values are not aligned
+    SnapshotReader lR(lData.data(), static_cast<unsigned int>(lData.size()));
+
+    KMS_TEST_COMPARE(lR.Get_UInt(), 0x12345678U);
+    KMS_TEST_ASSERT(0 == strcmp("Test", lR.Get_String()));
+    KMS_TEST_ASSERT(L"\u00c9tat" == lR.Get_WString());
+    KMS_TEST_ASSERT(lR.Get_WString().empty());
+    KMS_TEST_ASSERT(0 == memcmp(DATA, lR.Get_Data(sizeof(DATA)), sizeof(DATA)));
+    KMS_TEST_ASSERT(lR.IsAtEnd());
+    KMS_TEST_COMPARE(lR.GetOffset_byte(), static_cast<unsigned int>(lData.size()));
+
+    // Get_UInt - Truncated snapshot
+    try
+    {
+        lR.Get_UInt();
+        KMS_TEST_ASSERT(false);
+    }
+    KMS_TEST_CATCH(RESULT_INVALID_FORMAT)
+}
+
+KMS_TEST(Snapshot_File_PC6, "Auto", sTest_File_PC6)
+{
+    TRiLOGI::File_PC6 lA;
+    TRiLOGI::File_PC6 lB;
+
+    std::vector<uint8_t> lData;
+
+    SnapshotWriter lW(&lData);
+
+    lA.Read(File::Folder::CURRENT, "Tests\\Test00\\PLC\\PLC.PC6");
+
+    // ReadHash - Same key as Read, without decoding the file
+    unsigned int lSize_byte;
+
+    KMS_TEST_ASSERT(lA.GetHash() == TRiLOGI::File_PC6::ReadHash(File::Folder::CURRENT, "Tests\\Test00\\PLC\\PLC.PC6", &lSize_byte));
+    KMS_TEST_COMPARE(lSize_byte, lA.GetSize_byte());
+
+    // WriteSnapshot / ReadSnapshot - Same lines
+    lA.WriteSnapshot(&lW);
+
+    SnapshotReader lR(lData.data(), static_cast<unsigned int>(lData.size()));
+
+    lB.ReadSnapshot(&lR, lA.GetHash(), lSize_byte);
+    KMS_TEST_ASSERT(lR.IsAtEnd());
+
+    KMS_TEST_ASSERT(0 < lB.GetLineCount());
+    KMS_TEST_COMPARE(lB.GetLineCount(), lA.GetLineCount());
+    KMS_TEST_ASSERT(lA.GetHash() == lB.GetHash());
+
+    for (unsigned int i = 0; i < lA.GetLineCount(); i++)
+    {
+        KMS_TEST_ASSERT(0 == wcscmp(lA.GetLine(i), lB.GetLine(i)));
+    }
+
+    // ReadSnapshot - A line outside of the buffer
+    lData[lData.size() - 1] = 0xff;
+
+    SnapshotReader lR2(lData.data(), static_cast<unsigned int>(lData.size()));
+
+    try
+    {
+        lB.ReadSnapshot(&lR2, lA.GetHash(), lSize_byte);
+        KMS_TEST_ASSERT(false);
+    }
+    KMS_TEST_CATCH(RESULT_INVALID_FORMAT)
+}
@@ -48,12 +48,16 @@ Case_Exception;
 static const Case_Normal CASE_N[] =
 {
     {      0, TESTS "Test00", nullptr  , nullptr         },
-    {      0, TESTS "Test01", "PLC.PC6", "PLC.PC6.*.bak" },
+    {      0, TESTS "Test01", "PLC.PC6", "PLC.PC6.bak*"  },
     // { 5130, TESTS "Test02", nullptr , nullptr         }, // TODO Result change between 4874 and 5130
-    {      0, TESTS "Test06", "PLC.PC6", "PLC.PC6.*.bak" },
+    {      0, TESTS "Test06", "PLC.PC6", "PLC.PC6.bak*"  },
     {      0, TESTS "Test07", "PLC.PC6", nullptr         },
     { - 2046, TESTS "Test08", nullptr  , nullptr         },
     { - 2046, TESTS "Test09", nullptr  , nullptr         },
+    {      0, TESTS "Test12", nullptr  , "EXPORTED_*"    },
+    {      0, TESTS "Test13", "PLC.PC6", "PLC.PC6.bak*"  },
+    {      0, TESTS "Test14", "PLC.PC6", "PLC.PC6.bak*"  },
+    {      0, TESTS "Test15", nullptr  , "*.snapshot"    },
     // {   0, TESTS "Test10", nullptr  , nullptr         }, // Request user input
 };
 
@@ -15,8 +15,8 @@ using namespace KMS;
 KMS_TEST(TRiLOGI_BitList_Base, "Auto", sTest_Base)
 {
     // Constructor
-          TRiLOGI::BitList lBL  ("Test", 0, 64);
-    const TRiLOGI::BitList lBL_C("Test", 0, 64);
+          TRiLOGI::BitList lBL  ("Test", TRiLOGI::SymbolKind::INPUT, 0, 64);
+    const TRiLOGI::BitList lBL_C("Test", TRiLOGI::SymbolKind::INPUT, 0, 64);
 
     // GetAddresses
 
@@ -25,17 +25,35 @@ KMS_TEST(TRiLOGI_BitList_Base, "Auto", sTest_Base)
     // Display_ByIndex
 
     // Import
+    KMS_TEST_ASSERT( lBL.Import("iA"));
+    KMS_TEST_ASSERT(!lBL.Import("iA"));
+    KMS_TEST_ASSERT( lBL.Import("iB", 62));
+    KMS_TEST_ASSERT(!lBL.Import("iC", 62));
+    KMS_TEST_ASSERT( lBL.Import("iC"));
+
+    lBL.SetProjectType(ProjectType::NEW);
+
+    KMS_TEST_ASSERT( lBL.Import("iD"));
+    KMS_TEST_ASSERT( lBL.Import("iE", 1));
+    KMS_TEST_ASSERT( lBL.Import("iF"));
 
     // ===== ObjectList =====================================================
 
     // Clear
 
     // GetCount
+    KMS_TEST_COMPARE(lBL  .GetCount(), 6U);
+    KMS_TEST_COMPARE(lBL_C.GetCount(), 0U);
 
     // FindObject_ByIndex
     KMS_TEST_ASSERT(nullptr == lBL_C.FindObject_ByIndex(0));
+    KMS_TEST_ASSERT(nullptr == lBL_C.FindObject_ByIndex(64));
 
     // FindObject_ByName
+    KMS_TEST_ASSERT(lBL.FindObject_ByName("iA") == lBL.FindObject_ByIndex(63));
+    KMS_TEST_ASSERT(lBL.FindObject_ByName("iC") == lBL.FindObject_ByIndex(61));
+    KMS_TEST_ASSERT(lBL.FindObject_ByName("iD") == lBL.FindObject_ByIndex( 0));
+    KMS_TEST_ASSERT(lBL.FindObject_ByName("iF") == lBL.FindObject_ByIndex( 2));
 
     // Clean
 
@@ -0,0 +1,94 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A-Test/TRiLOGI_Lexer.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../KMS-PLC-A/TRiLOGI/Lexer.h"
+
+using namespace KMS;
+
+KMS_TEST(TRiLOGI_Lexer_Base, "Auto", sTest_Base)
+{
+    // Constructor
+    TRiLOGI::Lexer lL("Tests\\Lexer.PC6.txt");
+
+    // GetNextStatement - The empty lines and the comments are skipped
+    KMS_TEST_ASSERT(lL.GetNextStatement());
+    KMS_TEST_ASSERT(TRiLOGI::Keyword::INPUT == lL.GetKeyword());
+    KMS_TEST_COMPARE(lL.GetArgCount(), 2U);
+    KMS_TEST_ASSERT(0 == strcmp("iA", lL.GetArg(0)));
+    KMS_TEST_COMPARE(lL.GetArg_UInt(1), 0U);
+    KMS_TEST_COMPARE(lL.GetLineNo(), 8U);
+
+    // GetLine - Without the leading blanks and the end of line
+    KMS_TEST_ASSERT(0 == strcmp("INPUT iA 0", lL.GetLine()));
+
+    // GetNextStatement - Blanks, tabulation and comment at the end
+    KMS_TEST_ASSERT(lL.GetNextStatement());
+    KMS_TEST_ASSERT(TRiLOGI::Keyword::OUTPUT == lL.GetKeyword());
+    KMS_TEST_COMPARE(lL.GetArgCount(), 2U);
+    KMS_TEST_ASSERT(0 == strcmp("oB", lL.GetArg(0)));
+    KMS_TEST_COMPARE(lL.GetArg_UInt(1), 1U);
+
+    // GetNextStatement - Optional argument missing
+    KMS_TEST_ASSERT(lL.GetNextStatement());
+    KMS_TEST_ASSERT(TRiLOGI::Keyword::RELAY == lL.GetKeyword());
+    KMS_TEST_COMPARE(lL.GetArgCount(), 1U);
+    KMS_TEST_ASSERT(0 == strcmp("rC", lL.GetArg(0)));
+
+    // GetNextStatement - String, kept as written
+    KMS_TEST_ASSERT(lL.GetNextStatement());
+    KMS_TEST_ASSERT(TRiLOGI::Keyword::CONSTANT == lL.GetKeyword());
+    KMS_TEST_COMPARE(lL.GetArgCount(), 2U);
+    KMS_TEST_ASSERT(0 == strcmp("Message", lL.GetArg(0)));
+    KMS_TEST_ASSERT(0 == strcmp("\"Hello\"", lL.GetArg(1)));
+    KMS_TEST_COMPARE(lL.GetLineNo(), 11U);
+
+    // GetNextStatement - Invalid unsigned integer
+    KMS_TEST_ASSERT(lL.GetNextStatement());
+    KMS_TEST_ASSERT(TRiLOGI::Keyword::INVALID == lL.GetKeyword());
+    KMS_TEST_COMPARE(lL.GetLineNo(), 13U);
+
+    // GetNextStatement - Required argument missing
+    KMS_TEST_ASSERT(lL.GetNextStatement());
+    KMS_TEST_ASSERT(TRiLOGI::Keyword::INVALID == lL.GetKeyword());
+
+    // GetNextStatement - Unknown keyword
+    KMS_TEST_ASSERT(lL.GetNextStatement());
+    KMS_TEST_ASSERT(TRiLOGI::Keyword::INVALID == lL.GetKeyword());
+    KMS_TEST_ASSERT(0 == strcmp("Ignored line for test", lL.GetLine()));
+
+    // GetParser - The function code keeps its leading blanks, not its end
+    //             of line
+    KMS_TEST_ASSERT(lL.GetNextStatement());
+    KMS_TEST_ASSERT(TRiLOGI::Keyword::FUNCTION == lL.GetKeyword());
+    KMS_TEST_ASSERT(0 == strcmp("Fn_1", lL.GetArg(0)));
+
+    char lLine[LINE_LENGTH];
+
+    KMS_TEST_ASSERT(lL.GetParser()->GetNextLine_Raw(lLine, sizeof(lLine)));
+    KMS_TEST_ASSERT(0 == strcmp("    A = 1", lLine));
+
+    KMS_TEST_ASSERT(lL.GetParser()->GetNextLine_Raw(lLine, sizeof(lLine)));
+    KMS_TEST_ASSERT(0 == strcmp("FUNCTION END", lLine));
+
+    // GetNextStatement - Line ending with \n only
+    KMS_TEST_ASSERT(lL.GetNextStatement());
+    KMS_TEST_ASSERT(TRiLOGI::Keyword::ADDRESS == lL.GetKeyword());
+    KMS_TEST_COMPARE(lL.GetArgCount(), 1U);
+    KMS_TEST_ASSERT(0 == strcmp("wD", lL.GetArg(0)));
+
+    // GetNextStatement - Last line without end of line
+    KMS_TEST_ASSERT(lL.GetNextStatement());
+    KMS_TEST_ASSERT(TRiLOGI::Keyword::COUNTER == lL.GetKeyword());
+    KMS_TEST_COMPARE(lL.GetArg_UInt(1), 2U);
+    KMS_TEST_COMPARE(lL.GetLineNo(), 20U);
+
+    // GetNextStatement - End of file
+    KMS_TEST_ASSERT(!lL.GetNextStatement());
+}
@@ -0,0 +1,124 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A-Test/TRiLOGI_Optimizer.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/TRiLOGI/DefineList.h"
+
+#include "../KMS-PLC-A/TRiLOGI/Optimizer.h"
+
+using namespace KMS;
+
+KMS_TEST(TRiLOGI_Optimizer_Base, "Auto", sTest_Base)
+{
+    TRiLOGI::SymbolTable lST;
+
+    TRiLOGI::DefineList lDefines;
+
+    lDefines.SetSymbolTable(&lST);
+
+    KMS_TEST_ASSERT(lDefines.ImportConstant("BASE" , "&H10"));
+    KMS_TEST_ASSERT(lDefines.ImportConstant("DEBUG", "0"));
+    KMS_TEST_ASSERT(lDefines.ImportConstant("MAX"  , "10"));
+    KMS_TEST_ASSERT(lDefines.ImportConstant("TEXT" , "\"Text\""));
+
+    std::vector<std::string> lLines;
+
+    lLines.push_back("// Function F");
+    lLines.push_back("A = MAX * 2 + 1\r");
+    lLines.push_back("DM[BASE + 1] = A & 1");
+    lLines.push_back("B = 2 + 3 & 1");
+    lLines.push_back("IF DEBUG THEN");
+    lLines.push_back("    SETLCD 1, 1, \"MAX\" ' MAX");
+    lLines.push_back("ELSE");
+    lLines.push_back("    C = 4 / 0 + TEXT");
+    lLines.push_back("ENDIF");
+    lLines.push_back("IF MAX > 5 THEN");
+    lLines.push_back("    D = A + 2 * (3 - 1)");
+    lLines.push_back("ENDIF");
+
+    // Constructor
+    TRiLOGI::Optimizer lO(lST);
+
+    // Optimize
+    KMS_TEST_COMPARE(lO.Optimize("F", &lLines), 7U);
+
+    KMS_TEST_COMPARE(lLines.size(), static_cast<size_t>(6));
+    KMS_TEST_ASSERT(lLines[0] == "// Function F");
+    KMS_TEST_ASSERT(lLines[1] == "A = 21\r");
+    KMS_TEST_ASSERT(lLines[2] == "DM[17] = A & 1");
+    KMS_TEST_ASSERT(lLines[3] == "B = 2 + 3 & 1");
+    KMS_TEST_ASSERT(lLines[4] == "    C = 4 / 0 + TEXT");
+    KMS_TEST_ASSERT(lLines[5] == "    D = A + 4");
+
+    // A branch containing a label stays
+    lLines.clear();
+    lLines.push_back("IF 0 THEN");
+    lLines.push_back("@10 A = 1");
+    lLines.push_back("ENDIF");
+
+    KMS_TEST_COMPARE(lO.Optimize("F", &lLines), 0U);
+    KMS_TEST_COMPARE(lLines.size(), static_cast<size_t>(3));
+
+    // The IF statements are not all blocks
+    lLines.clear();
+    lLines.push_back("IF 1 THEN");
+    lLines.push_back("    IF A > 1 THEN A = 0");
+    lLines.push_back("ENDIF");
+
+    KMS_TEST_COMPARE(lO.Optimize("F", &lLines), 0U);
+    KMS_TEST_COMPARE(lLines.size(), static_cast<size_t>(3));
+
+    // DisplayStats
+    lO.DisplayStats();
+}
+
+KMS_TEST(TRiLOGI_Optimizer_Minify, "Auto", sTest_Minify)
+{
+    TRiLOGI::SymbolTable lST;
+
+    std::vector<std::string> lLines;
+
+    lLines.push_back("// Function F");
+    lLines.push_back("// Imported using KMS-PLC");
+    lLines.push_back("");
+    lLines.push_back("    A = B + 1    ' Increment\r");
+    lLines.push_back("    IF A > 10 THEN  REM Limit");
+    lLines.push_back("        SETLCD 1, 1, \"A  =  \" + STR$(A)");
+    lLines.push_back("        GOTO @10");
+    lLines.push_back("    ENDIF");
+    lLines.push_back("    C = A & HB");
+    lLines.push_back("    D = A - -1");
+
+    TRiLOGI::Optimizer lO(lST);
+
+    // SetFold
+    lO.SetFold(false);
+
+    // SetMinify
+    lO.SetMinify(true);
+
+    // Optimize
+    KMS_TEST_COMPARE(lO.Optimize("F", &lLines), 1U);
+
+    KMS_TEST_COMPARE(lLines.size(), static_cast<size_t>(7));
+    KMS_TEST_ASSERT(lLines[0] == "A=B+1\r");
+    KMS_TEST_ASSERT(lLines[1] == "IF A>10 THEN");
+    KMS_TEST_ASSERT(lLines[2] == "SETLCD 1,1,\"A  =  \"+STR$(A)");
+    KMS_TEST_ASSERT(lLines[3] == "GOTO @10");
+    KMS_TEST_ASSERT(lLines[4] == "ENDIF");
+    KMS_TEST_ASSERT(lLines[5] == "C=A& HB");
+    KMS_TEST_ASSERT(lLines[6] == "D=A- -1");
+
+    // GetReadable
+    KMS_TEST_ASSERT(0 == lO.GetReadable().find("FUNCTION F\n// Function F\n"));
+    KMS_TEST_ASSERT(std::string::npos != lO.GetReadable().find("    A = B + 1    ' Increment\n"));
+
+    // Optimize - Already minified
+    KMS_TEST_COMPARE(lO.Optimize("F", &lLines), 0U);
+}
@@ -0,0 +1,217 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A-Test/TRiLOGI_Reachability.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/TRiLOGI/BitList.h"
+#include "../Common/TRiLOGI/DefineList.h"
+#include "../Common/TRiLOGI/File_PC6.h"
+#include "../Common/TRiLOGI/FunctionList.h"
+#include "../Common/TRiLOGI/LineList.h"
+
+#include "../KMS-PLC-A/TRiLOGI/Function.h"
+#include "../KMS-PLC-A/TRiLOGI/Reachability.h"
+
+using namespace KMS;
+
+KMS_TEST(TRiLOGI_Reachability_Base, "Auto", sTest_Base)
+{
+    TRiLOGI::SymbolTable lST;
+
+    TRiLOGI::BitList lRelays("relay", TRiLOGI::SymbolKind::RELAY, 0, 64);
+
+    lRelays.SetSymbolTable(&lST);
+
+    KMS_TEST_ASSERT(lRelays.Import("rUsed"));
+    KMS_TEST_ASSERT(lRelays.Import("rDead"));
+    KMS_TEST_ASSERT(lRelays.Import("rComment"));
+
+    TRiLOGI::File_PC6 lFile;
+
+    lFile.AddLine(L"Header\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#0,20\r");
+    lFile.AddLine(L"CALL 2 ' rComment\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#1,20\r");
+    lFile.AddLine(L"SETIO rUsed : CALL 1\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#2,20\r");
+    lFile.AddLine(L"CALL Dead // rComment\r");
+    lFile.AddLine(L"0,Start\r");
+    lFile.AddLine(L"1,Helper\r");
+    lFile.AddLine(L"2,Dead\r");
+
+    TRiLOGI::FunctionList lFunctions;
+
+    lFunctions.SetSymbolTable(&lST);
+
+    lFunctions.Parse_Code(lFile,  1, 10);
+    lFunctions.Parse_Name(lFile, 10, 13);
+
+    TRiLOGI::LineList lCircuits;
+
+    lCircuits.AddLine(L"%LStart=/iA\r");
+
+    // Constructor
+    TRiLOGI::Reachability lR(lST, &lFunctions);
+
+    // Analyze
+    lR.Analyze(lCircuits);
+
+    // IsReached
+    KMS_TEST_ASSERT( lR.IsReached(lFunctions.Find_ByName("Start" ), TRiLOGI::SymbolKind::FUNCTION));
+    KMS_TEST_ASSERT( lR.IsReached(lFunctions.Find_ByName("Helper"), TRiLOGI::SymbolKind::FUNCTION));
+    KMS_TEST_ASSERT(!lR.IsReached(lFunctions.Find_ByName("Dead"  ), TRiLOGI::SymbolKind::FUNCTION));
+
+    KMS_TEST_ASSERT( lR.IsReached(lRelays.FindObject_ByName("rUsed"   ), TRiLOGI::SymbolKind::RELAY));
+    KMS_TEST_ASSERT(!lR.IsReached(lRelays.FindObject_ByName("rComment"), TRiLOGI::SymbolKind::RELAY));
+    KMS_TEST_ASSERT(!lR.IsReached(lRelays.FindObject_ByName("rDead"   ), TRiLOGI::SymbolKind::RELAY));
+
+    // ===== ObjectList =====================================================
+
+    // Verify_Reachability
+    KMS_TEST_COMPARE(lFunctions.Verify_Reachability(lR, TRiLOGI::SymbolKind::FUNCTION, nullptr), 1U);
+    KMS_TEST_COMPARE(lRelays   .Verify_Reachability(lR, TRiLOGI::SymbolKind::RELAY   , nullptr), 2U);
+
+    // Clean
+    KMS_TEST_COMPARE(lFunctions.Clean(), 1U);
+    KMS_TEST_COMPARE(lRelays   .Clean(), 2U);
+
+    KMS_TEST_ASSERT(nullptr == lFunctions.Find_ByName("Dead"));
+    KMS_TEST_ASSERT(nullptr == lRelays.FindObject_ByName("rDead"));
+}
+
+KMS_TEST(TRiLOGI_Reachability_Constant, "Auto", sTest_Constant)
+{
+    TRiLOGI::SymbolTable lST;
+
+    TRiLOGI::DefineList lDefines;
+
+    lDefines.SetSymbolTable(&lST);
+
+    KMS_TEST_ASSERT(lDefines.ImportConstant("FN_HELPER", "2"));
+
+    TRiLOGI::File_PC6 lFile;
+
+    lFile.AddLine(L"Header\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#0,20\r");
+    lFile.AddLine(L"CALL FN_HELPER\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#1,20\r");
+    lFile.AddLine(L"A = 1\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#2,20\r");
+    lFile.AddLine(L"INTRDEF 1, I, 1\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#3,20\r");
+    lFile.AddLine(L"A = 2\r");
+    lFile.AddLine(L"0,Start\r");
+    lFile.AddLine(L"1,Helper\r");
+    lFile.AddLine(L"2,Other\r");
+    lFile.AddLine(L"3,Last\r");
+
+    TRiLOGI::FunctionList lFunctions;
+
+    lFunctions.SetSymbolTable(&lST);
+
+    lFunctions.Parse_Code(lFile,  1, 13);
+    lFunctions.Parse_Name(lFile, 13, 17);
+
+    // Analyze - The constant gives the function number
+    TRiLOGI::LineList lCircuits;
+
+    lCircuits.AddLine(L"%LStart=/iA\r");
+
+    TRiLOGI::Reachability lR0(lST, &lFunctions);
+
+    lR0.Analyze(lCircuits);
+
+    KMS_TEST_ASSERT( lR0.IsReached(lFunctions.Find_ByName("Helper"), TRiLOGI::SymbolKind::FUNCTION));
+    KMS_TEST_ASSERT(!lR0.IsReached(lFunctions.Find_ByName("Other" ), TRiLOGI::SymbolKind::FUNCTION));
+    KMS_TEST_ASSERT(!lR0.IsReached(lFunctions.Find_ByName("Last"  ), TRiLOGI::SymbolKind::FUNCTION));
+
+    // Analyze - A variable gives the function number, all the functions
+    //           are reached
+    lCircuits.ClearList();
+    lCircuits.AddLine(L"%LOther=/iA\r");
+
+    TRiLOGI::Reachability lR1(lST, &lFunctions);
+
+    lR1.Analyze(lCircuits);
+
+    KMS_TEST_ASSERT(lR1.IsReached(lFunctions.Find_ByName("Start" ), TRiLOGI::SymbolKind::FUNCTION));
+    KMS_TEST_ASSERT(lR1.IsReached(lFunctions.Find_ByName("Helper"), TRiLOGI::SymbolKind::FUNCTION));
+    KMS_TEST_ASSERT(lR1.IsReached(lFunctions.Find_ByName("Last"  ), TRiLOGI::SymbolKind::FUNCTION));
+
+    KMS_TEST_COMPARE(lFunctions.Verify_Reachability(lR1, TRiLOGI::SymbolKind::FUNCTION, nullptr), 0U);
+}
+
+KMS_TEST(TRiLOGI_Reachability_HSCDEF, "Auto", sTest_HSCDEF)
+{
+    TRiLOGI::SymbolTable lST;
+
+    TRiLOGI::File_PC6 lFile;
+
+    lFile.AddLine(L"Header\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#0,20\r");
+    lFile.AddLine(L"HSCDEF 1, 2, 1000\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#1,20\r");
+    lFile.AddLine(L"A = 1\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#2,20\r");
+    lFile.AddLine(L"CALL 2 + A\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#3,20\r");
+    lFile.AddLine(L"A = 2\r");
+    lFile.AddLine(L"0,Start\r");
+    lFile.AddLine(L"1,Handler\r");
+    lFile.AddLine(L"2,Other\r");
+    lFile.AddLine(L"3,Dead\r");
+
+    TRiLOGI::FunctionList lFunctions;
+
+    lFunctions.SetSymbolTable(&lST);
+
+    lFunctions.Parse_Code(lFile,  1, 13);
+    lFunctions.Parse_Name(lFile, 13, 17);
+
+    // Analyze - HSCDEF gives the function number as its second argument
+    TRiLOGI::LineList lCircuits;
+
+    lCircuits.AddLine(L"%LStart=/iA\r");
+
+    TRiLOGI::Reachability lR0(lST, &lFunctions);
+
+    lR0.Analyze(lCircuits);
+
+    KMS_TEST_ASSERT( lR0.IsReached(lFunctions.Find_ByName("Handler"), TRiLOGI::SymbolKind::FUNCTION));
+    KMS_TEST_ASSERT(!lR0.IsReached(lFunctions.Find_ByName("Other"  ), TRiLOGI::SymbolKind::FUNCTION));
+    KMS_TEST_ASSERT(!lR0.IsReached(lFunctions.Find_ByName("Dead"   ), TRiLOGI::SymbolKind::FUNCTION));
+
+    // Analyze - An expression gives the function number, all the functions
+    //           are reached
+    lCircuits.ClearList();
+    lCircuits.AddLine(L"%LOther=/iA\r");
+
+    TRiLOGI::Reachability lR1(lST, &lFunctions);
+
+    lR1.Analyze(lCircuits);
+
+    KMS_TEST_ASSERT(lR1.IsReached(lFunctions.Find_ByName("Dead"), TRiLOGI::SymbolKind::FUNCTION));
+
+    // Clean - Only the function nothing reaches is removed
+    KMS_TEST_COMPARE(lFunctions.Verify_Reachability(lR0, TRiLOGI::SymbolKind::FUNCTION, nullptr), 2U);
+    KMS_TEST_COMPARE(lFunctions.Clean(), 2U);
+
+    KMS_TEST_ASSERT(nullptr != lFunctions.Find_ByName("Handler"));
+    KMS_TEST_ASSERT(nullptr == lFunctions.Find_ByName("Dead"));
+}
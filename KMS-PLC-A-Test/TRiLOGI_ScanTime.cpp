@@ -0,0 +1,150 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A-Test/TRiLOGI_ScanTime.cpp
+
+#include "Component.h"
+
+// ===== C++ ================================================================
+#include <sstream>
+
+// ===== Local ==============================================================
+#include "../Common/TRiLOGI/DefineList.h"
+#include "../Common/TRiLOGI/File_PC6.h"
+#include "../Common/TRiLOGI/FunctionList.h"
+#include "../Common/TRiLOGI/LineList.h"
+#include "../Common/TRiLOGI/ScanTime.h"
+
+using namespace KMS;
+
+KMS_TEST(TRiLOGI_ScanTime_Base, "Auto", sTest_Base)
+{
+    TRiLOGI::SymbolTable lST;
+
+    TRiLOGI::File_PC6 lFile;
+
+    lFile.AddLine(L"Header\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#0,20\r");
+    lFile.AddLine(L"' Start\r");
+    lFile.AddLine(L"FOR I = 1 TO 3\r");
+    lFile.AddLine(L"    CALL 2\r");
+    lFile.AddLine(L"NEXT\r");
+    lFile.AddLine(L"IF A > 1 THEN\r");
+    lFile.AddLine(L"    PRINT #1 \"A\"\r");
+    lFile.AddLine(L"ELSE\r");
+    lFile.AddLine(L"    A = 1\r");
+    lFile.AddLine(L"ENDIF\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#1,20\r");
+    lFile.AddLine(L"@10 A = A + 1\r");
+    lFile.AddLine(L"CALL 2\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#2,20\r");
+    lFile.AddLine(L"IF A THEN ' Check\r");
+    lFile.AddLine(L"    A = 1\r");
+    lFile.AddLine(L"ELSE ' Slow path\r");
+    lFile.AddLine(L"    PRINT #1 \"B\"\r");
+    lFile.AddLine(L"ENDIF\r");
+    lFile.AddLine(L"0,Start\r");
+    lFile.AddLine(L"1,Helper\r");
+    lFile.AddLine(L"2,Other\r");
+
+    TRiLOGI::FunctionList lFunctions;
+
+    lFunctions.SetSymbolTable(&lST);
+
+    lFunctions.Parse_Code(lFile,  1, 23);
+    lFunctions.Parse_Name(lFile, 23, 26);
+
+    TRiLOGI::LineList lCircuits;
+
+    lCircuits.AddLine(L"%LStart=/iA*iB\r");
+    lCircuits.AddLine(L"oMotor=iA\r");
+    lCircuits.AddLine(L"\r");
+
+    // Constructor
+    TRiLOGI::ScanTime lS;
+
+    // Report
+    // Helper  A = A + 1 (30) + CALL (30), the recursive call adds nothing
+    // Start   FOR (30) + 3 * (CALL (30) + Helper (60) + NEXT (30))
+    //         + IF (30) + PRINT (1000)
+    // Circuit 1  5 + 2 * 1 + 2 + CusFn (20) + Start (1420)
+    // Other   IF (30) + PRINT (1000), the ELSE branch costs more
+    // Circuit 2  5 + 1 + 2
+    std::ostringstream lOut;
+
+    KMS_TEST_COMPARE(lS.Report(lOut, lST, lCircuits, &lFunctions), static_cast<uint64_t>(1457));
+
+    KMS_TEST_ASSERT(std::string::npos != lOut.str().find("Circuit 1  1449 us"));
+    KMS_TEST_ASSERT(std::string::npos != lOut.str().find("Circuit 2  8 us"));
+    KMS_TEST_ASSERT(std::string::npos != lOut.str().find("Function Start  1420 us"));
+    KMS_TEST_ASSERT(std::string::npos != lOut.str().find("Function Helper  60 us"));
+    KMS_TEST_ASSERT(std::string::npos != lOut.str().find("Function Other  1030 us"));
+    KMS_TEST_ASSERT(std::string::npos != lOut.str().find("Total  1457 us"));
+
+    // Validate
+    lS.Validate();
+}
+
+KMS_TEST(TRiLOGI_ScanTime_Call, "Auto", sTest_Call)
+{
+    TRiLOGI::SymbolTable lST;
+
+    TRiLOGI::DefineList lDefines;
+
+    lDefines.SetSymbolTable(&lST);
+
+    KMS_TEST_ASSERT(lDefines.ImportConstant("FN_B", "2"));
+
+    TRiLOGI::File_PC6 lFile;
+
+    lFile.AddLine(L"Header\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#0,20\r");
+    lFile.AddLine(L"CALL FN_B\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#1,20\r");
+    lFile.AddLine(L"PRINT #1 \"B\"\r");
+    lFile.AddLine(L"CALL 3\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#2,20\r");
+    lFile.AddLine(L"CALL 2\r");
+    lFile.AddLine(L"\xc8\r");
+    lFile.AddLine(L"Fn#3,20\r");
+    lFile.AddLine(L"CALL I\r");
+    lFile.AddLine(L"0,A\r");
+    lFile.AddLine(L"1,B\r");
+    lFile.AddLine(L"2,C\r");
+    lFile.AddLine(L"3,D\r");
+
+    TRiLOGI::FunctionList lFunctions;
+
+    lFunctions.SetSymbolTable(&lST);
+
+    lFunctions.Parse_Code(lFile,  1, 14);
+    lFunctions.Parse_Name(lFile, 14, 18);
+
+    TRiLOGI::LineList lCircuits;
+
+    lCircuits.AddLine(L"%LC=/iA\r");
+
+    TRiLOGI::ScanTime lS;
+
+    // Report
+    // C  CALL (30) + B, B calls C again and gets a partial cost
+    // B  PRINT (1000) + CALL (30) + C (1060), not the partial cost
+    // A  CALL (30) + B, the constant FN_B gives the function number
+    // D  CALL (30) + A, the most expensive function
+    std::ostringstream lOut;
+
+    KMS_TEST_COMPARE(lS.Report(lOut, lST, lCircuits, &lFunctions), static_cast<uint64_t>(1088));
+
+    KMS_TEST_ASSERT(std::string::npos != lOut.str().find("Function A  2120 us"));
+    KMS_TEST_ASSERT(std::string::npos != lOut.str().find("Function B  2090 us"));
+    KMS_TEST_ASSERT(std::string::npos != lOut.str().find("Function C  1060 us"));
+    KMS_TEST_ASSERT(std::string::npos != lOut.str().find("Function D  2150 us"));
+}
@@ -0,0 +1,58 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A-Test/TRiLOGI_SymbolTable.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/TRiLOGI/BitList.h"
+
+using namespace KMS;
+
+KMS_TEST(TRiLOGI_SymbolTable_Base, "Auto", sTest_Base)
+{
+    // Constructor
+    TRiLOGI::SymbolTable lST;
+
+    TRiLOGI::BitList lInputs("input", TRiLOGI::SymbolKind::INPUT, 0, 64);
+    TRiLOGI::BitList lRelays("relay", TRiLOGI::SymbolKind::RELAY, 0, 64);
+
+    lInputs.SetSymbolTable(&lST);
+    lRelays.SetSymbolTable(&lST);
+
+    // Insert - One symbol for the objects of the same name
+    KMS_TEST_ASSERT(lInputs.Import("A", 0));
+    KMS_TEST_ASSERT(lRelays.Import("A"));
+    KMS_TEST_ASSERT(lRelays.Import("B"));
+
+    // GetCount
+    KMS_TEST_COMPARE(lST.GetCount(), 2U);
+
+    // Remove - The symbol keeps the name of the remaining object, the
+    //          arena of the cleared list no longer contains the name.
+    lInputs.ClearList();
+
+    KMS_TEST_COMPARE(lST.GetCount(), 2U);
+
+    // Find
+    KMS_TEST_ASSERT(nullptr == lST.Find("A", TRiLOGI::SymbolKind::INPUT));
+    KMS_TEST_ASSERT(nullptr != lST.Find("A", TRiLOGI::SymbolKind::RELAY));
+
+    // Remove - The symbol without object is removed
+    lRelays.ClearList();
+
+    KMS_TEST_COMPARE(lST.GetCount(), 0U);
+    KMS_TEST_ASSERT(nullptr == lST.Find("A"));
+
+    // BeginParallel / EndParallel
+    lST.BeginParallel();
+    {
+        KMS_TEST_ASSERT(lRelays.Import("C"));
+    }
+    lST.EndParallel();
+
+    KMS_TEST_ASSERT(nullptr != lST.Find("C", TRiLOGI::SymbolKind::RELAY));
+}
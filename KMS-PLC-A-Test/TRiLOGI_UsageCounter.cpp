@@ -0,0 +1,47 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A-Test/TRiLOGI_UsageCounter.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/TRiLOGI/File_PC6.h"
+
+#include "../KMS-PLC-A/TRiLOGI/UsageCounter.h"
+
+using namespace KMS;
+
+KMS_TEST(TRiLOGI_UsageCounter_Base, "Auto", sTest_Base)
+{
+    TRiLOGI::File_PC6 lFile;
+
+    lFile.AddLine(L"0,tTimerA 2\r");
+    lFile.AddLine(L"1,tTimerAB 3\r");
+    lFile.AddLine(L"oMotorA=/rPanic*tTimerA*tTimerAB\r");
+    lFile.AddLine(L"aaa\r");
+
+    // Constructor
+    TRiLOGI::UsageCounter lUC;
+
+    // AddName
+    lUC.AddName("aa");
+    lUC.AddName("oMotorA");
+    lUC.AddName("rPanic");
+    lUC.AddName("tTimerA");
+    lUC.AddName("tTimerA");
+    lUC.AddName("tTimerAB");
+
+    // Count
+    lUC.Count(lFile);
+
+    // GetCount
+    KMS_TEST_COMPARE(lUC.GetCount("aa"      ), 1U);
+    KMS_TEST_COMPARE(lUC.GetCount("oMotorA" ), 1U);
+    KMS_TEST_COMPARE(lUC.GetCount("rPanic"  ), 1U);
+    KMS_TEST_COMPARE(lUC.GetCount("tTimerA" ), 4U);
+    KMS_TEST_COMPARE(lUC.GetCount("tTimerAB"), 2U);
+    KMS_TEST_COMPARE(lUC.GetCount("Unknown" ), 0U);
+}
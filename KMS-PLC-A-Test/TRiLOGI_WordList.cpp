@@ -0,0 +1,136 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A-Test/TRiLOGI_WordList.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/TRiLOGI/WordList.h"
+
+#include "../KMS-PLC-A/TRiLOGI/Word.h"
+
+using namespace KMS;
+
+KMS_RESULT_STATIC(RESULT_ALREADY_EXIST);
+KMS_RESULT_STATIC(RESULT_TOO_MANY);
+
+KMS_TEST(TRiLOGI_WordList_Base, "Auto", sTest_Base)
+{
+    TRiLOGI::Word lA("A", 0, 0, "");
+    TRiLOGI::Word lB("B", 1, 0, "");
+    TRiLOGI::Word lC("C", 2, 0, "");
+
+    // Constructor
+    TRiLOGI::WordList lWL;
+
+    // ReserveOffsets - Legacy, the highest free offsets below OffsetNew
+    lWL.mOffsetNew = 10;
+
+    KMS_TEST_COMPARE(lWL.ReserveOffsets(2), 9U);
+
+    lA.SetOffset(9);  lWL.AddWord(&lA);
+    lB.SetOffset(10); lWL.AddWord(&lB);
+
+    KMS_TEST_COMPARE(lWL.ReserveOffsets(1), 8U);
+
+    // ReserveOffsets - Legacy, the range skips the used offsets
+    lC.SetOffset(7); lWL.AddWord(&lC);
+
+    KMS_TEST_COMPARE(lWL.ReserveOffsets(2), 5U);
+
+    // RemoveWord
+    lWL.RemoveWord(&lA);
+    lWL.RemoveWord(&lB);
+    lWL.RemoveWord(&lC);
+
+    KMS_TEST_COMPARE(lWL.GetCount(), 0U);
+
+    // SetProjectType
+    lWL.SetProjectType(ProjectType::NEW);
+
+    // ReserveOffsets - New, the lowest free offsets above OffsetNew
+    lWL.mOffsetMax = 20;
+
+    KMS_TEST_COMPARE(lWL.ReserveOffsets(3), 2U);
+
+    lA.SetOffset(2); lWL.AddWord(&lA);
+    lB.SetOffset(4); lWL.AddWord(&lB);
+
+    KMS_TEST_COMPARE(lWL.ReserveOffsets(1), 3U);
+    KMS_TEST_COMPARE(lWL.ReserveOffsets(2), 5U);
+
+    // ReserveOffsets - An offset whose AddWord fails stays free
+    KMS_TEST_COMPARE(lWL.ReserveOffsets(1), 3U);
+
+    lC.SetOffset(2);
+
+    try
+    {
+        lWL.AddWord(&lC);
+        KMS_TEST_ASSERT(false);
+    }
+    KMS_TEST_CATCH(RESULT_ALREADY_EXIST)
+
+    KMS_TEST_COMPARE(lWL.ReserveOffsets(1), 3U);
+}
+
+KMS_TEST(TRiLOGI_WordList_Exception, "Auto", sTest_Exception)
+{
+    TRiLOGI::Word lA("A", 0, 1, "");
+    TRiLOGI::Word lB("B", 1, 2, "");
+    TRiLOGI::Word lC("C", 2, 3, "");
+
+    TRiLOGI::WordList lWL;
+
+    // ReserveOffsets - Legacy, the range 1 to OffsetNew is full
+    lWL.mOffsetNew = 3;
+
+    KMS_TEST_COMPARE(lWL.ReserveOffsets(3), 1U);
+
+    lWL.AddWord(&lA);
+    lWL.AddWord(&lB);
+
+    try
+    {
+        lWL.ReserveOffsets(2);
+        KMS_TEST_ASSERT(false);
+    }
+    KMS_TEST_CATCH(RESULT_TOO_MANY)
+
+    lWL.AddWord(&lC);
+
+    try
+    {
+        lWL.ReserveOffsets(1);
+        KMS_TEST_ASSERT(false);
+    }
+    KMS_TEST_CATCH(RESULT_TOO_MANY)
+
+    // ReserveOffsets - New, the range OffsetNew to OffsetMax is full
+    lWL.RemoveWord(&lA);
+    lWL.RemoveWord(&lB);
+    lWL.RemoveWord(&lC);
+
+    lWL.SetProjectType(ProjectType::NEW);
+
+    lWL.mOffsetMax = 4;
+
+    lC.SetOffset(4);
+
+    KMS_TEST_COMPARE(lWL.ReserveOffsets(3), 2U);
+
+    lWL.AddWord(&lB);
+    lWL.AddWord(&lC);
+
+    try
+    {
+        lWL.ReserveOffsets(2);
+        KMS_TEST_ASSERT(false);
+    }
+    KMS_TEST_CATCH(RESULT_TOO_MANY)
+
+    KMS_TEST_COMPARE(lWL.ReserveOffsets(1), 3U);
+}
@@ -0,0 +1,81 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A-Test/TRiLOGI_WordRelocation.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/TRiLOGI/DefineList.h"
+
+#include "../KMS-PLC-A/TRiLOGI/Word.h"
+#include "../KMS-PLC-A/TRiLOGI/WordRelocation.h"
+
+using namespace KMS;
+
+KMS_TEST(TRiLOGI_WordRelocation_Base, "Auto", sTest_Base)
+{
+    TRiLOGI::SymbolTable lST;
+
+    TRiLOGI::DefineList lDefines;
+
+    lDefines.SetSymbolTable(&lST);
+
+    KMS_TEST_ASSERT(lDefines.ImportWord("A", 10));
+    KMS_TEST_ASSERT(lDefines.ImportWord("B", 20));
+    KMS_TEST_ASSERT(lDefines.ImportWord("C", 30));
+
+    // Constructor
+    TRiLOGI::WordRelocation lWR;
+
+    // ===== DefineList =====================================================
+
+    // RelocateWords - The highest free offsets of a legacy project
+    std::vector<unsigned int> lOffsets;
+
+    lOffsets.push_back(10);
+    lOffsets.push_back(20);
+    lOffsets.push_back(30);
+
+    KMS_TEST_ASSERT(lDefines.RelocateWords(lOffsets, &lWR));
+
+    KMS_TEST_ASSERT(0 == strcmp("A", lDefines.mWords.Find_ByOffset(997)->GetName()));
+    KMS_TEST_ASSERT(0 == strcmp("B", lDefines.mWords.Find_ByOffset(998)->GetName()));
+    KMS_TEST_ASSERT(0 == strcmp("C", lDefines.mWords.Find_ByOffset(999)->GetName()));
+    KMS_TEST_ASSERT(nullptr == lDefines.mWords.Find_ByOffset(10));
+
+    // GetTo
+    KMS_TEST_COMPARE(lWR.GetTo(20), 998U);
+    KMS_TEST_COMPARE(lWR.GetTo(11),   0U);
+
+    // Rewrite
+    std::string lLine("DM[10] = dm[20] + DM[I] + ADM[10] ' DM[30]");
+
+    KMS_TEST_ASSERT(lWR.Rewrite(&lLine));
+    KMS_TEST_ASSERT(lLine == "DM[997] = dm[998] + DM[I] + ADM[10] ' DM[30]");
+
+    lLine = "SETLCD 1, 1, \"DM[10]\" : A = DM[11]";
+
+    KMS_TEST_ASSERT(!lWR.Rewrite(&lLine));
+
+    std::wstring lCircuit(L"DM[30] REM DM[10]");
+
+    KMS_TEST_ASSERT(lWR.Rewrite(&lCircuit));
+    KMS_TEST_ASSERT(lCircuit == L"DM[999] REM DM[10]");
+
+    // GetIndirectCount
+    KMS_TEST_COMPARE(lWR.GetIndirectCount(), 1U);
+
+    // GetRewriteCount
+    KMS_TEST_COMPARE(lWR.GetRewriteCount(), 3U);
+
+    // RelocateWords - Already consecutive
+    lOffsets.clear();
+    lOffsets.push_back(997);
+    lOffsets.push_back(998);
+    lOffsets.push_back(999);
+
+    KMS_TEST_ASSERT(!lDefines.RelocateWords(lOffsets, &lWR));
+}
@@ -0,0 +1,126 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A-Test/Utilities.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../KMS-PLC-A/Utilities.h"
+
+using namespace KMS;
+
+static std::vector<uint8_t> ToVector(const char* aText);
+
+KMS_TEST(Utilities_Delta, "Auto", sTest_Delta)
+{
+    std::vector<uint8_t> lDelta;
+    std::vector<uint8_t> lOut;
+
+    // Utl_Delta_Create / Utl_Delta_Apply - Change in the middle
+    auto lNew = ToVector("Fn#0,20\r\nA = 2\r\nB = 3\r\n");
+    auto lOld = ToVector("Fn#0,20\r\nA = 1\r\nB = 3\r\n");
+
+    Utl_Delta_Create(lOld, lNew, &lDelta);
+    Utl_Delta_Apply (lDelta, lNew, &lOut);
+    KMS_TEST_ASSERT(lOld == lOut);
+
+    // Utl_Delta_Create / Utl_Delta_Apply - Identical contents
+    Utl_Delta_Create(lNew, lNew, &lDelta);
+    Utl_Delta_Apply (lDelta, lNew, &lOut);
+    KMS_TEST_ASSERT(lNew == lOut);
+
+    // Utl_Delta_Create / Utl_Delta_Apply - Lines added, then removed
+    lOld = ToVector("Fn#0,20\r\n");
+
+    Utl_Delta_Create(lOld, lNew, &lDelta);
+    Utl_Delta_Apply (lDelta, lNew, &lOut);
+    KMS_TEST_ASSERT(lOld == lOut);
+
+    Utl_Delta_Create(lNew, lOld, &lDelta);
+    Utl_Delta_Apply (lDelta, lOld, &lOut);
+    KMS_TEST_ASSERT(lNew == lOut);
+
+    // Utl_Delta_Create / Utl_Delta_Apply - Empty content
+    lOld.clear();
+
+    Utl_Delta_Create(lOld, lNew, &lDelta);
+    Utl_Delta_Apply (lDelta, lNew, &lOut);
+    KMS_TEST_ASSERT(lOut.empty());
+}
+
+KMS_TEST(Utilities_Exception, "Auto", sTest_Exception)
+{
+    std::vector<uint8_t> lDelta;
+    std::vector<uint8_t> lOut;
+
+    auto lNew   = ToVector("A = 2\r\n");
+    auto lOld   = ToVector("A = 1\r\n");
+    auto lOther = ToVector("A = 3\r\n");
+
+    Utl_Delta_Create(lOld, lNew, &lDelta);
+
+    // Utl_Delta_Apply - The delta applies only to the content it was
+    //                   created with
+    try
+    {
+        Utl_Delta_Apply(lDelta, lOther, &lOut);
+        KMS_TEST_ASSERT(false);
+    }
+    KMS_TEST_CATCH(RESULT_INVALID_FORMAT)
+
+    // Utl_Delta_Apply - Truncated delta
+    lDelta.resize(4);
+
+    try
+    {
+        Utl_Delta_Apply(lDelta, lNew, &lOut);
+        KMS_TEST_ASSERT(false);
+    }
+    KMS_TEST_CATCH(RESULT_INVALID_FORMAT)
+}
+
+KMS_TEST(Utilities_Delta_Sort, "Auto", sTest_Delta_Sort)
+{
+    std::vector<std::string> lDeltas;
+
+    // Utl_Delta_Sort - 12 deltas in the same second, others in the previous
+    //                  seconds and days, a name without time
+    for (unsigned int i = 0; i < 12; i++)
+    {
+        lDeltas.push_back("PLC.PC6.bak.20261017_101530_" + std::to_string(i) + ".delta");
+    }
+
+    lDeltas.push_back("PLC.PC6.bak.20261017_101529_1.delta");
+    lDeltas.push_back("PLC.PC6.bak.20261017_101529_0.delta");
+    lDeltas.push_back("PLC.PC6.bak.20261017_095959_3.delta");
+    lDeltas.push_back("PLC.PC6.bak.20261016_235959_0.delta");
+    lDeltas.push_back("PLC.PC6.bak.20261018_000000_0.delta");
+    lDeltas.push_back("PLC.PC6.bak.Other.delta");
+
+    Utl_Delta_Sort("PLC.PC6.bak", &lDeltas);
+
+    KMS_TEST_COMPARE(static_cast<unsigned int>(lDeltas.size()), 17U);
+
+    KMS_TEST_ASSERT(lDeltas[ 0] == "PLC.PC6.bak.20261018_000000_0.delta");
+    KMS_TEST_ASSERT(lDeltas[ 1] == "PLC.PC6.bak.20261017_101530_11.delta");
+    KMS_TEST_ASSERT(lDeltas[ 2] == "PLC.PC6.bak.20261017_101530_10.delta");
+    KMS_TEST_ASSERT(lDeltas[ 3] == "PLC.PC6.bak.20261017_101530_9.delta");
+    KMS_TEST_ASSERT(lDeltas[12] == "PLC.PC6.bak.20261017_101530_0.delta");
+    KMS_TEST_ASSERT(lDeltas[13] == "PLC.PC6.bak.20261017_101529_1.delta");
+    KMS_TEST_ASSERT(lDeltas[14] == "PLC.PC6.bak.20261017_101529_0.delta");
+    KMS_TEST_ASSERT(lDeltas[15] == "PLC.PC6.bak.20261017_095959_3.delta");
+    KMS_TEST_ASSERT(lDeltas[16] == "PLC.PC6.bak.20261016_235959_0.delta");
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+std::vector<uint8_t> ToVector(const char* aText)
+{
+    assert(nullptr != aText);
+
+    return std::vector<uint8_t>(aText, aText + strlen(aText));
+}
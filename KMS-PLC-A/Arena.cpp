@@ -0,0 +1,127 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/Arena.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/Arena.h"
+
+using namespace KMS;
+
+KMS_RESULT_STATIC(RESULT_TOO_LARGE);
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define BLOCK_SIZE_byte (64 * 1024)
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+Arena::Arena() : mBlock(0), mDestructors(nullptr), mOffset_byte(0) {}
+
+Arena::~Arena()
+{
+    Reset();
+
+    for (auto lBlock : mBlocks)
+    {
+        assert(nullptr != lBlock);
+
+        delete[] lBlock;
+    }
+}
+
+void* Arena::Allocate(unsigned int aSize_byte, unsigned int aAlign_byte)
+{
+    assert(0 < aSize_byte);
+    assert(0 < aAlign_byte);
+    assert(0 == (aAlign_byte & (aAlign_byte - 1)));
+
+    KMS_EXCEPTION_ASSERT(BLOCK_SIZE_byte >= aSize_byte, RESULT_TOO_LARGE, "The allocation does not fit in an arena block", aSize_byte);
+
+    for (;;)
+    {
+        if (mBlocks.size() <= mBlock)
+        {
+            mBlocks.push_back(new uint8_t[BLOCK_SIZE_byte]);
+        }
+
+        auto lOffset_byte = (mOffset_byte + aAlign_byte - 1) & ~(aAlign_byte - 1);
+
+        if (BLOCK_SIZE_byte >= lOffset_byte + aSize_byte)
+        {
+            mOffset_byte = lOffset_byte + aSize_byte;
+
+            return mBlocks[mBlock] + lOffset_byte;
+        }
+
+        mBlock++;
+        mOffset_byte = 0;
+    }
+}
+
+const char* Arena::Copy(const char* aString)
+{
+    assert(nullptr != aString);
+
+    auto lSize_byte = static_cast<unsigned int>(strlen(aString)) + 1;
+
+    auto lResult = static_cast<char*>(Allocate(lSize_byte, 1));
+
+    memcpy(lResult, aString, lSize_byte);
+
+    return lResult;
+}
+
+const wchar_t* Arena::Copy(const wchar_t* aString)
+{
+    assert(nullptr != aString);
+
+    auto lSize_byte = static_cast<unsigned int>((wcslen(aString) + 1) * sizeof(wchar_t));
+
+    auto lResult = static_cast<wchar_t*>(Allocate(lSize_byte, alignof(wchar_t)));
+
+    memcpy(lResult, aString, lSize_byte);
+
+    return lResult;
+}
+
+// Allocate selects a block with enough free space. The space is then given
+// back, so the next allocation starts at the same place.
+void* Arena::Reserve(unsigned int aMax_byte, unsigned int aAlign_byte)
+{
+    auto lResult = Allocate(aMax_byte, aAlign_byte);
+
+    mOffset_byte -= aMax_byte;
+
+    return lResult;
+}
+
+void Arena::Commit(unsigned int aSize_byte)
+{
+    assert(BLOCK_SIZE_byte >= mOffset_byte + aSize_byte);
+
+    mOffset_byte += aSize_byte;
+}
+
+// The blocks stay allocated, so parsing the file again does not allocate
+// memory.
+void Arena::Reset()
+{
+    while (nullptr != mDestructors)
+    {
+        auto lDestructor = mDestructors;
+
+        mDestructors = lDestructor->mNext;
+
+        lDestructor->mDestroy(lDestructor->mObject);
+    }
+
+    mBlock       = 0;
+    mOffset_byte = 0;
+}
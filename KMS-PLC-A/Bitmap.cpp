@@ -0,0 +1,197 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/Bitmap.cpp
+
+#include "Component.h"
+
+// ===== Windows ============================================================
+#include <intrin.h>
+
+// ===== Local ==============================================================
+#include "../Common/Bitmap.h"
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define WORD_BITS (32)
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+const unsigned int Bitmap::NOT_FOUND = 0xffffffff;
+
+Bitmap::Bitmap(unsigned int aSize) : mSize(aSize), mWords((aSize + WORD_BITS - 1) / WORD_BITS, 0)
+{
+    assert(0 < aSize);
+}
+
+void Bitmap::Clear() { mWords.assign(mWords.size(), 0); }
+
+void Bitmap::Clear(unsigned int aBit)
+{
+    assert(mSize > aBit);
+
+    mWords[aBit / WORD_BITS] &= ~(1U << (aBit % WORD_BITS));
+}
+
+void Bitmap::Set(unsigned int aBit)
+{
+    assert(mSize > aBit);
+
+    mWords[aBit / WORD_BITS] |= 1U << (aBit % WORD_BITS);
+}
+
+void Bitmap::Set(unsigned int aFirst, unsigned int aCount)
+{
+    assert(mSize >= aFirst + aCount);
+
+    for (auto lBit = aFirst; lBit < aFirst + aCount; lBit++)
+    {
+        Set(lBit);
+    }
+}
+
+bool Bitmap::Test(unsigned int aBit) const
+{
+    assert(mSize > aBit);
+
+    return 0 != (mWords[aBit / WORD_BITS] & (1U << (aBit % WORD_BITS)));
+}
+
+unsigned int Bitmap::GetSize() const { return mSize; }
+
+unsigned int Bitmap::FindOne_Dec (unsigned int aFirst, unsigned int aEnd) const { return Find_Dec(aFirst, aEnd,          0); }
+unsigned int Bitmap::FindOne_Inc (unsigned int aFirst, unsigned int aEnd) const { return Find_Inc(aFirst, aEnd,          0); }
+unsigned int Bitmap::FindZero_Dec(unsigned int aFirst, unsigned int aEnd) const { return Find_Dec(aFirst, aEnd, 0xffffffff); }
+unsigned int Bitmap::FindZero_Inc(unsigned int aFirst, unsigned int aEnd) const { return Find_Inc(aFirst, aEnd, 0xffffffff); }
+
+unsigned int Bitmap::FindZeros_Dec(unsigned int aFirst, unsigned int aEnd, unsigned int aCount) const
+{
+    assert(0 < aCount);
+
+    auto lEnd = aEnd;
+
+    for (;;)
+    {
+        auto lLast = FindZero_Dec(aFirst, lEnd);
+        if ((NOT_FOUND == lLast) || (aFirst + aCount > lLast + 1))
+        {
+            break;
+        }
+
+        auto lResult = lLast + 1 - aCount;
+
+        auto lOne = FindOne_Dec(lResult, lLast);
+        if (NOT_FOUND == lOne)
+        {
+            return lResult;
+        }
+
+        lEnd = lOne;
+    }
+
+    return NOT_FOUND;
+}
+
+unsigned int Bitmap::FindZeros_Inc(unsigned int aFirst, unsigned int aEnd, unsigned int aCount) const
+{
+    assert(0 < aCount);
+
+    auto lFirst = aFirst;
+
+    for (;;)
+    {
+        auto lResult = FindZero_Inc(lFirst, aEnd);
+        if ((NOT_FOUND == lResult) || (lResult + aCount > aEnd))
+        {
+            break;
+        }
+
+        auto lOne = FindOne_Inc(lResult + 1, lResult + aCount);
+        if (NOT_FOUND == lOne)
+        {
+            return lResult;
+        }
+
+        lFirst = lOne + 1;
+    }
+
+    return NOT_FOUND;
+}
+
+// Private
+// //////////////////////////////////////////////////////////////////////////
+
+// aInvert  0xffffffff to search for a cleared bit, 0 to search for a set
+//          bit
+unsigned int Bitmap::Find_Dec(unsigned int aFirst, unsigned int aEnd, uint32_t aInvert) const
+{
+    assert(aFirst <= aEnd);
+    assert(mSize >= aEnd);
+
+    if (aFirst < aEnd)
+    {
+        auto lFirstWord = aFirst / WORD_BITS;
+
+        for (auto lWord = (aEnd - 1) / WORD_BITS + 1; lWord > lFirstWord; lWord--)
+        {
+            unsigned long lBit;
+
+            if (_BitScanReverse(&lBit, GetWord(lWord - 1, aFirst, aEnd, aInvert)))
+            {
+                return (lWord - 1) * WORD_BITS + lBit;
+            }
+        }
+    }
+
+    return NOT_FOUND;
+}
+
+unsigned int Bitmap::Find_Inc(unsigned int aFirst, unsigned int aEnd, uint32_t aInvert) const
+{
+    assert(aFirst <= aEnd);
+    assert(mSize >= aEnd);
+
+    if (aFirst < aEnd)
+    {
+        auto lLastWord = (aEnd - 1) / WORD_BITS;
+
+        for (auto lWord = aFirst / WORD_BITS; lWord <= lLastWord; lWord++)
+        {
+            unsigned long lBit;
+
+            if (_BitScanForward(&lBit, GetWord(lWord, aFirst, aEnd, aInvert)))
+            {
+                return lWord * WORD_BITS + lBit;
+            }
+        }
+    }
+
+    return NOT_FOUND;
+}
+
+// Return the searched bits of the word as set bits, limited to the bits of
+// the [aFirst, aEnd) range.
+uint32_t Bitmap::GetWord(unsigned int aWord, unsigned int aFirst, unsigned int aEnd, uint32_t aInvert) const
+{
+    assert(mWords.size() > aWord);
+
+    auto lResult = mWords[aWord] ^ aInvert;
+
+    auto lBase = aWord * WORD_BITS;
+
+    if (lBase < aFirst)
+    {
+        lResult &= 0xffffffff << (aFirst - lBase);
+    }
+
+    if (lBase + WORD_BITS > aEnd)
+    {
+        lResult &= 0xffffffff >> (lBase + WORD_BITS - aEnd);
+    }
+
+    return lResult;
+}
@@ -0,0 +1,121 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/DepFile.cpp
+
+#include "Component.h"
+
+// ===== C++ ================================================================
+#include <set>
+#include <string>
+
+// ===== Local ==============================================================
+#include "DepFile.h"
+#include "Utilities.h"
+
+using namespace KMS;
+
+// Data type and constants
+// //////////////////////////////////////////////////////////////////////////
+
+typedef std::set<std::string> FileSet;
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static void AddFileName(std::string* aOut, const std::string& aFileName);
+
+// Static variables
+// //////////////////////////////////////////////////////////////////////////
+
+static FileSet sInputs;
+static FileSet sOutputs;
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+void DepFile::AddInput(const char* aFileName)
+{
+    assert(nullptr != aFileName);
+
+    sInputs.insert(aFileName);
+}
+
+void DepFile::AddOutput(const char* aFileName)
+{
+    assert(nullptr != aFileName);
+
+    sOutputs.insert(aFileName);
+}
+
+void DepFile::Clear()
+{
+    sInputs .clear();
+    sOutputs.clear();
+}
+
+void DepFile::Write(const char* aFileName)
+{
+    assert(nullptr != aFileName);
+
+    std::string lText;
+
+    if (sOutputs.empty())
+    {
+        AddFileName(&lText, aFileName);
+    }
+    else
+    {
+        for (const auto& lOutput : sOutputs)
+        {
+            if (!lText.empty())
+            {
+                lText += " ";
+            }
+
+            AddFileName(&lText, lOutput);
+        }
+    }
+
+    lText += ":";
+
+    for (const auto& lInput : sInputs)
+    {
+        lText += " \\\n ";
+
+        AddFileName(&lText, lInput);
+    }
+
+    lText += "\n";
+
+    // The dependency file keeps its time stamp when the dependencies do not
+    // change.
+    Utl_WriteIfChanged(File::Folder::CURRENT, aFileName, std::vector<uint8_t>(lText.begin(), lText.end()));
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// make and ninja accept the / separator on Windows. The space and the # are
+// escaped using \ and the $, using $.
+void AddFileName(std::string* aOut, const std::string& aFileName)
+{
+    assert(nullptr != aOut);
+
+    for (auto lC : aFileName)
+    {
+        switch (lC)
+        {
+        case '\\': *aOut += '/'; break;
+
+        case ' ':
+        case '#': *aOut += '\\'; *aOut += lC; break;
+
+        case '$': *aOut += "$$"; break;
+
+        default: *aOut += lC;
+        }
+    }
+}
@@ -0,0 +1,29 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/DepFile.h
+
+#pragma once
+
+// The DepFile collects the files an execution reads and writes. The build
+// system reads the dependency file it produces, in the make format, to know
+// when it must execute KMS-PLC again.
+class DepFile
+{
+
+public:
+
+    static void AddInput (const char* aFileName);
+    static void AddOutput(const char* aFileName);
+
+    static void Clear();
+
+    // The outputs are the targets and the inputs, their prerequisites. When
+    // the execution writes no file, the dependency file is the target.
+    //
+    // Exception  RESULT_REPLACE_FAILED
+    static void Write(const char* aFileName);
+
+};
@@ -13,6 +13,9 @@
 // ===== Local ==============================================================
 #include "../Common/Types.h"
 
+class SnapshotReader;
+class SnapshotWriter;
+
 namespace EBPro
 {
 
@@ -27,6 +30,9 @@ namespace EBPro
 
         Address(const char* aName, AddressType aType, const char* aAddr, unsigned int aLineNo);
 
+        // Exception  RESULT_INVALID_FORMAT
+        Address(SnapshotReader* aReader);
+
         const char * GetAddress       () const;
         uint16_t     GetAddress_UInt16() const;
         unsigned int GetLineNo        () const;
@@ -38,6 +44,8 @@ namespace EBPro
         bool Set(AddressType aType, unsigned int aAddr);
         bool Set(AddressType aType, const char*  aAddr);
 
+        void WriteSnapshot(SnapshotWriter* aWriter) const;
+
     private:
 
         std::string  mAddress;
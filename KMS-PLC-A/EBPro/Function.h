@@ -17,6 +17,9 @@
 // ===== Local ==============================================================
 #include "EBPro/DataType.h"
 
+class SnapshotReader;
+class SnapshotWriter;
+
 namespace EBPro
 {
 
@@ -37,8 +40,12 @@ namespace EBPro
 
         unsigned int Read(const KMS::Text::File_ASCII& aFile, unsigned int aLineNo);
 
+        void ReadSnapshot(SnapshotReader* aReader);
+
         void Write(FILE* aOut) const;
 
+        void WriteSnapshot(SnapshotWriter* aWriter) const;
+
     private:
 
         void ParseDefinition(const char* aLine);
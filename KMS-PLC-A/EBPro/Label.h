@@ -14,6 +14,9 @@
 // ===== Import/Includes ====================================================
 #include <KMS/DI/Array.h>
 
+class SnapshotReader;
+class SnapshotWriter;
+
 namespace EBPro
 {
 
@@ -34,10 +37,14 @@ namespace EBPro
 
         void Read(FILE* aFile);
 
+        void ReadSnapshot(SnapshotReader* aReader);
+
         void Verify() const;
 
         void Write(FILE* aFile) const;
 
+        void WriteSnapshot(SnapshotWriter* aWriter) const;
+
         LabelState* FindOrCreate(unsigned int aState, bool* aChanged);
 
         std::wstring mName;
@@ -13,6 +13,8 @@
 #include <KMS/Convert.h>
 
 // ===== Local ==============================================================
+#include "../Common/Snapshot.h"
+
 #include "EBPro/Address.h"
 
 using namespace KMS;
@@ -141,6 +143,23 @@ namespace EBPro
         assert(nullptr != aAddr);
     }
 
+    Address::Address(SnapshotReader* aReader)
+    {
+        assert(nullptr != aReader);
+
+        mAddress  = aReader->Get_String();
+        mComment  = aReader->Get_String();
+        mDataType = aReader->Get_String();
+        mLineNo   = aReader->Get_UInt();
+        mName     = aReader->Get_String();
+
+        auto lType = aReader->Get_UInt();
+
+        KMS_EXCEPTION_ASSERT(static_cast<unsigned int>(AddressType::QTY) > lType, RESULT_INVALID_FORMAT, "Invalid address type in the snapshot", lType);
+
+        mType = static_cast<AddressType>(lType);
+    }
+
     const char* Address::GetAddress() const { return mAddress.c_str(); }
 
     uint16_t Address::GetAddress_UInt16() const { return Convert::ToUInt16(mAddress.c_str()); }
@@ -193,6 +212,18 @@ namespace EBPro
         return lResult;
     }
 
+    void Address::WriteSnapshot(SnapshotWriter* aWriter) const
+    {
+        assert(nullptr != aWriter);
+
+        aWriter->Add_String(mAddress .c_str());
+        aWriter->Add_String(mComment .c_str());
+        aWriter->Add_String(mDataType.c_str());
+        aWriter->Add_UInt  (mLineNo);
+        aWriter->Add_String(mName    .c_str());
+        aWriter->Add_UInt  (static_cast<unsigned int>(mType));
+    }
+
 }
 
 // Static functions
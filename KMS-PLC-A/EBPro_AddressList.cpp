@@ -18,6 +18,8 @@
 
 #include "../Common/EBPro/AddressList.h"
 
+#include "DepFile.h"
+
 #include "EBPro/Address.h"
 
 using namespace KMS;
@@ -95,6 +97,34 @@ namespace EBPro
         }
     }
 
+    // The snapshot also contains the lines of the CSV file, Import adds the
+    // new addresses to them.
+    void AddressList::ReadSnapshot(SnapshotReader* aReader)
+    {
+        assert(nullptr != aReader);
+
+        if (IsExportedConfigured())
+        {
+            DepFile::AddInput(GetExported());
+        }
+
+        auto lLineCount = aReader->Get_UInt();
+        for (unsigned int i = 0; i < lLineCount; i++)
+        {
+            mFile_CSV.AddLine(aReader->Get_String());
+        }
+
+        auto lCount = aReader->Get_UInt();
+        for (unsigned int i = 0; i < lCount; i++)
+        {
+            auto lA = new Address(aReader);
+
+            mAddresses.push_back(lA);
+
+            mAddresses_ByName.insert(ByName::value_type(lA->GetName(), lA));
+        }
+    }
+
     void AddressList::Verify() const
     {
         ::Console::Progress_Begin("EBPro", "Verifying addresses");
@@ -125,6 +155,27 @@ namespace EBPro
         ::Console::Progress_End("Verified");
     }
 
+    void AddressList::WriteSnapshot(SnapshotWriter* aWriter) const
+    {
+        assert(nullptr != aWriter);
+
+        aWriter->Add_UInt(static_cast<unsigned int>(mFile_CSV.mLines.size()));
+
+        for (const auto& lLine : mFile_CSV.mLines)
+        {
+            aWriter->Add_String(lLine.c_str());
+        }
+
+        aWriter->Add_UInt(static_cast<unsigned int>(mAddresses.size()));
+
+        for (auto lAddress : mAddresses)
+        {
+            assert(nullptr != lAddress);
+
+            lAddress->WriteSnapshot(aWriter);
+        }
+    }
+
     // ===== List ===========================================================
 
     AddressList::~AddressList()
@@ -8,6 +8,8 @@
 #include "Component.h"
 
 // ===== Local ==============================================================
+#include "../Common/Snapshot.h"
+
 #include "EBPro/DataPtr.h"
 #include "EBPro/Function.h"
 
@@ -121,6 +123,26 @@ namespace EBPro
         KMS_EXCEPTION(RESULT_INVALID_SOURCE, "No FUNCTION END before the end of the source file", "");
     }
 
+    // The values are in the order Read finds them in the MLB file
+    void Function::ReadSnapshot(SnapshotReader* aReader)
+    {
+        assert(nullptr != aReader);
+
+        mName       = aReader->Get_String();
+        mReturnType = UInt32_to_DataType(aReader->Get_UInt());
+
+        auto lArgCount = aReader->Get_UInt();
+        for (unsigned int i = 0; i < lArgCount; i++)
+        {
+            mArguments.push_back(UInt32_to_DataType(aReader->Get_UInt()));
+        }
+
+        mFunctionCode = aReader->Get_UInt();
+        mCode         = aReader->Get_String();
+        mComment0     = aReader->Get_String();
+        mComment1     = aReader->Get_String();
+    }
+
     void Function::Write(FILE* aOut) const
     {
         DataPtr::Write(aOut, 104);
@@ -140,6 +162,25 @@ namespace EBPro
         DataPtr::Write(aOut, mComment1);
     }
 
+    void Function::WriteSnapshot(SnapshotWriter* aWriter) const
+    {
+        assert(nullptr != aWriter);
+
+        aWriter->Add_String(mName.c_str());
+        aWriter->Add_UInt  (DataType_to_UInt32(mReturnType));
+        aWriter->Add_UInt  (static_cast<unsigned int>(mArguments.size()));
+
+        for (auto lType : mArguments)
+        {
+            aWriter->Add_UInt(DataType_to_UInt32(lType));
+        }
+
+        aWriter->Add_UInt  (mFunctionCode);
+        aWriter->Add_String(mCode    .c_str());
+        aWriter->Add_String(mComment0.c_str());
+        aWriter->Add_String(mComment1.c_str());
+    }
+
     // Private
     // //////////////////////////////////////////////////////////////////////
 
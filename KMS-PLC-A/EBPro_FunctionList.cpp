@@ -12,6 +12,8 @@
 
 #include "../Common/EBPro/FunctionList.h"
 
+#include "DepFile.h"
+
 #include "EBPro/DataPtr.h"
 #include "EBPro/Function.h"
 
@@ -50,6 +52,49 @@ namespace EBPro
         }
     }
 
+    void FunctionList::ReadSnapshot(SnapshotReader* aReader)
+    {
+        assert(nullptr != aReader);
+
+        if (IsExportedConfigured())
+        {
+            DepFile::AddInput(GetExported());
+        }
+
+        mParsed_Type      = aReader->Get_String();
+        mParsed_Name      = aReader->Get_String();
+        mParsed_Values[0] = aReader->Get_UInt();
+        mParsed_Values[1] = aReader->Get_UInt();
+
+        auto lCount = aReader->Get_UInt();
+        for (unsigned int i = 0; i < lCount; i++)
+        {
+            auto lFunction = new Function();
+            lFunction->ReadSnapshot(aReader);
+
+            Add(lFunction);
+        }
+    }
+
+    void FunctionList::WriteSnapshot(SnapshotWriter* aWriter) const
+    {
+        assert(nullptr != aWriter);
+
+        aWriter->Add_String(mParsed_Type.c_str());
+        aWriter->Add_String(mParsed_Name.c_str());
+        aWriter->Add_UInt  (mParsed_Values[0]);
+        aWriter->Add_UInt  (mParsed_Values[1]);
+
+        aWriter->Add_UInt(static_cast<unsigned int>(mFunctions_ByName.size()));
+
+        for (const auto& lPair : mFunctions_ByName)
+        {
+            assert(nullptr != lPair.second);
+
+            lPair.second->WriteSnapshot(aWriter);
+        }
+    }
+
     // ===== List ===========================================================
 
     FunctionList::~FunctionList()
@@ -8,6 +8,8 @@
 #include "Component.h"
 
 // ===== Local ==============================================================
+#include "../Common/Snapshot.h"
+
 #include "EBPro/LabelState.h"
 #include "EBPro/Label.h"
 
@@ -136,6 +138,27 @@ namespace EBPro
         }
     }
 
+    void Label::ReadSnapshot(SnapshotReader* aReader)
+    {
+        assert(nullptr != aReader);
+
+        mName = aReader->Get_WString();
+
+        auto lStateCount = aReader->Get_UInt();
+        for (unsigned int i = 0; i < lStateCount; i++)
+        {
+            auto lState = new LabelState;
+
+            mStates.push_back(lState);
+
+            auto lStringCount = aReader->Get_UInt();
+            for (unsigned int j = 0; j < lStringCount; j++)
+            {
+                lState->mStrings.push_back(aReader->Get_WString());
+            }
+        }
+    }
+
     void Label::Verify() const
     {
         if (0 >= mStates.size())
@@ -181,6 +204,24 @@ namespace EBPro
         }
     }
 
+    void Label::WriteSnapshot(SnapshotWriter* aWriter) const
+    {
+        assert(nullptr != aWriter);
+
+        aWriter->Add_WString(mName);
+        aWriter->Add_UInt   (static_cast<unsigned int>(mStates.size()));
+
+        for (auto lState : mStates)
+        {
+            aWriter->Add_UInt(static_cast<unsigned int>(lState->mStrings.size()));
+
+            for (const auto& lString : lState->mStrings)
+            {
+                aWriter->Add_WString(lString);
+            }
+        }
+    }
+
     // Internal
     // //////////////////////////////////////////////////////////////////////
 
@@ -21,6 +21,7 @@
 #include "../Common/EBPro/LabelList.h"
 
 #include "Convert.h"
+#include "DepFile.h"
 
 #include "EBPro/LabelState.h"
 #include "EBPro/Label.h"
@@ -46,6 +47,8 @@ namespace EBPro
     {
         assert(nullptr != aSoftware);
 
+        memset(&mHeader, 0, sizeof(mHeader));
+
         mLanguages.SetCreator(DI::String::Create);
 
         Ptr_OF<DI::Object> lEntry;
@@ -61,6 +64,8 @@ namespace EBPro
 
             ::Console::Progress_Begin("EBPro", "Exporting", lPath.c_str());
             {
+                DepFile::AddOutput(lPath.c_str());
+
                 FILE* lFile;
 
                 auto lErr = fopen_s(&lFile, lPath.c_str(), "w,ccs=UTF-8");
@@ -93,6 +98,8 @@ namespace EBPro
 
             ::Console::Progress_Begin("EBPro", "Parsing", lExported);
             {
+                DepFile::AddInput(lExported);
+
                 FILE* lFile;
 
                 auto lErr = fopen_s(&lFile, lExported, "rb");
@@ -131,6 +138,28 @@ namespace EBPro
         }
     }
 
+    void LabelList::ReadSnapshot(SnapshotReader* aReader)
+    {
+        assert(nullptr != aReader);
+
+        if (IsExportedConfigured())
+        {
+            DepFile::AddInput(GetExported());
+        }
+
+        memcpy(mHeader, aReader->Get_Data(sizeof(mHeader)), sizeof(mHeader));
+
+        auto lCount = aReader->Get_UInt();
+        for (unsigned int i = 0; i < lCount; i++)
+        {
+            auto lLabel = new Label;
+
+            lLabel->ReadSnapshot(aReader);
+
+            mLabels.push_back(lLabel);
+        }
+    }
+
     void LabelList::Read() {}
 
     void LabelList::ValidateConfig() const
@@ -180,6 +209,22 @@ namespace EBPro
         ::Console::Progress_End("Verified");
     }
 
+    void LabelList::WriteSnapshot(SnapshotWriter* aWriter) const
+    {
+        assert(nullptr != aWriter);
+
+        aWriter->Add_Data(mHeader, sizeof(mHeader));
+
+        aWriter->Add_UInt(static_cast<unsigned int>(mLabels.size()));
+
+        for (auto lLabel : mLabels)
+        {
+            assert(nullptr != lLabel);
+
+            lLabel->WriteSnapshot(aWriter);
+        }
+    }
+
     // ===== List =======================================================
 
     LabelList::~LabelList()
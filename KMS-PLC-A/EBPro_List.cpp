@@ -17,6 +17,9 @@
 
 #include "../Common/EBPro/List.h"
 
+#include "DepFile.h"
+#include "Utilities.h"
+
 using namespace KMS;
 
 // Constants
@@ -53,6 +56,24 @@ namespace EBPro
 
     List::~List() {}
 
+    void List::GetExportedKey(uint64_t* aOut) const
+    {
+        assert(nullptr != aOut);
+
+        aOut[0] = 0;
+        aOut[1] = 0;
+
+        if (IsExportedConfigured() && File::Folder::CURRENT.DoesFileExist(GetExported()))
+        {
+            std::vector<uint8_t> lData;
+
+            Utl_ReadFile(File::Folder::CURRENT, GetExported(), &lData);
+
+            aOut[0] = Utl_Hash(lData.data(), static_cast<unsigned int>(lData.size()));
+            aOut[1] = lData.size();
+        }
+    }
+
     void List::Import()
     {
         auto lChanged = false;
@@ -64,6 +85,8 @@ namespace EBPro
 
             ::Console::Progress_Begin("EBPro", "Importing", lSource->Get());
             {
+                DepFile::AddInput(lSource->Get());
+
                 lChanged |= ImportSource(lSource->Get());
             }
             ::Console::Progress_End("Imported");
@@ -73,6 +96,8 @@ namespace EBPro
         {
             ::Console::Progress_Begin("EBPro", "Saving", mToImport.Get());
 
+            DepFile::AddOutput(mToImport.Get());
+
             SaveToImport();
         }
         else
@@ -98,6 +123,8 @@ namespace EBPro
         {
             ::Console::Progress_Begin("EBPro", "Reading", GetExported());
             {
+                DepFile::AddInput(GetExported());
+
                 ReadExported();
             }
             ::Console::Progress_End("Read");
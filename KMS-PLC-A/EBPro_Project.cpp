@@ -13,6 +13,8 @@
 #include <KMS/Proc/Process.h>
 
 // ===== Local ==============================================================
+#include "../Common/Snapshot.h"
+
 #include "../Common/EBPro/Project.h"
 
 using namespace KMS;
@@ -20,7 +22,8 @@ using namespace KMS;
 // Constants
 // //////////////////////////////////////////////////////////////////////////
 
-static const Cfg::MetaData MD_FILE_NAME("FileName = {Path}.emtp");
+static const Cfg::MetaData MD_FILE_NAME    ("FileName = {Path}.emtp");
+static const Cfg::MetaData MD_SNAPSHOT_FILE("SnapshotFile = {Path}");
 
 namespace EBPro
 {
@@ -28,17 +31,22 @@ namespace EBPro
     // Public
     // //////////////////////////////////////////////////////////////////////
 
-    const char* Project::FILE_NAME_DEFAULT = "";
+    const char* Project::FILE_NAME_DEFAULT     = "";
+    const char* Project::SNAPSHOT_FILE_DEFAULT = "";
 
     Project::Project()
         : mFileName(FILE_NAME_DEFAULT)
+        , mSnapshotFile(SNAPSHOT_FILE_DEFAULT)
         , mAddresses(&mSoftware)
         , mFunctions(&mSoftware)
         , mLabels(&mSoftware)
     {
+        memset(&mKey, 0, sizeof(mKey));
+
         Ptr_OF<DI::Object> lEntry;
 
-        lEntry.Set(&mFileName, false); AddEntry("FileName", lEntry, &MD_FILE_NAME);
+        lEntry.Set(&mFileName    , false); AddEntry("FileName"    , lEntry, &MD_FILE_NAME);
+        lEntry.Set(&mSnapshotFile, false); AddEntry("SnapshotFile", lEntry, &MD_SNAPSHOT_FILE);
 
         lEntry.Set(&mAddresses, false); AddEntry("Addresses", lEntry);
         lEntry.Set(&mFunctions, false); AddEntry("Functions", lEntry);
@@ -71,16 +79,28 @@ namespace EBPro
 
     void Project::Parse()
     {
-        mAddresses.Parse();
-        mFunctions.Parse();
-        mLabels   .Parse();
+        if (!mSnapshot.empty())
+        {
+            ReadSnapshot_Lists();
+        }
+        else
+        {
+            mAddresses.Parse();
+            mFunctions.Parse();
+            mLabels   .Parse();
+
+            WriteSnapshot();
+        }
     }
 
     void Project::Read()
     {
-        mAddresses.Read();
-        mFunctions.Read();
-        mLabels   .Read();
+        if (!ReadSnapshot())
+        {
+            mAddresses.Read();
+            mFunctions.Read();
+            mLabels   .Read();
+        }
     }
 
     void Project::Verify() const
@@ -89,4 +109,61 @@ namespace EBPro
         mLabels   .Verify();
     }
 
+    // Private
+    // //////////////////////////////////////////////////////////////////////
+
+    // The exported files are read to compute the key, but they are parsed
+    // only when the snapshot does not correspond to them.
+    bool Project::ReadSnapshot()
+    {
+        mSnapshot.clear();
+
+        if (0 >= mSnapshotFile.GetLength())
+        {
+            return false;
+        }
+
+        mAddresses.GetExportedKey(mKey + 0);
+        mFunctions.GetExportedKey(mKey + 2);
+        mLabels   .GetExportedKey(mKey + 4);
+
+        return Snapshot_Read(File::Folder::CURRENT, mSnapshotFile.Get(), mKey, sizeof(mKey) / sizeof(mKey[0]), &mSnapshot);
+    }
+
+    void Project::ReadSnapshot_Lists()
+    {
+        ::Console::Progress_Begin("EBPro", "Loading", mSnapshotFile.Get());
+        {
+            SnapshotReader lReader(mSnapshot.data(), static_cast<unsigned int>(mSnapshot.size()));
+
+            mAddresses.ReadSnapshot(&lReader);
+            mFunctions.ReadSnapshot(&lReader);
+            mLabels   .ReadSnapshot(&lReader);
+
+            KMS_EXCEPTION_ASSERT(lReader.IsAtEnd(), RESULT_INVALID_FORMAT, "Invalid snapshot", mSnapshotFile.Get());
+
+            // The objects copied the strings
+            std::vector<uint8_t>().swap(mSnapshot);
+        }
+        ::Console::Progress_End("Loaded");
+    }
+
+    void Project::WriteSnapshot() const
+    {
+        if (0 >= mSnapshotFile.GetLength())
+        {
+            return;
+        }
+
+        std::vector<uint8_t> lData;
+
+        SnapshotWriter lWriter(&lData);
+
+        mAddresses.WriteSnapshot(&lWriter);
+        mFunctions.WriteSnapshot(&lWriter);
+        mLabels   .WriteSnapshot(&lWriter);
+
+        Snapshot_Write(File::Folder::CURRENT, mSnapshotFile.Get(), mKey, sizeof(mKey) / sizeof(mKey[0]), lData);
+    }
+
 }
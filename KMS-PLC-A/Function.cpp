@@ -62,22 +62,23 @@ void Function::AddLine(const char* aLine)
     mLines.push_back(aLine);
 }
 
-void Function::Parse(Text::File_ASCII* aFile, Text::File_ASCII::Internal::iterator* aIt, const char* aEndMark)
+void Function::Parse(Parser* aParser, const char* aEndMark)
 {
-    assert(nullptr != aFile);
-    assert(nullptr != aIt);
+    assert(nullptr != aParser);
     assert(nullptr != aEndMark);
 
     auto lEndMarkLen = strlen(aEndMark);
 
-    for (; *aIt != aFile->mLines.end(); (*aIt)++)
+    char lLine[LINE_LENGTH];
+
+    while (aParser->GetNextLine_Raw(lLine, sizeof(lLine)))
     {
-        if (0 == strncmp(aEndMark, (*aIt)->c_str(), lEndMarkLen))
+        if (0 == strncmp(aEndMark, lLine, lEndMarkLen))
         {
             return;
         }
 
-        AddLine((*aIt)->c_str());
+        AddLine(lLine);
     }
 
     KMS_EXCEPTION(RESULT_INVALID_FUNCTION_FORMAT, "The function is not terminated", "");
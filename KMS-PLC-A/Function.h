@@ -11,8 +11,8 @@
 #include <string>
 #include <vector>
 
-// ===== Import/Includes ====================================================
-#include <KMS/Text/File_ASCII.h>
+// ===== Local ==============================================================
+#include "../Common/Parser.h"
 
 class Function
 {
@@ -23,7 +23,7 @@ public:
 
     void AddLine(const char* aLine);
 
-    void Parse(KMS::Text::File_ASCII* aFile, KMS::Text::File_ASCII::Internal::iterator* aIt, const char* aEndMark);
+    void Parse(Parser* aParser, const char* aEndMark);
 
 protected:
 
@@ -15,7 +15,7 @@ using namespace KMS;
 // Public
 // //////////////////////////////////////////////////////////////////////////
 
-Parser::Parser(const char* aFileName) : mFile(nullptr)
+Parser::Parser(const char* aFileName) : mFile(nullptr), mLineNo(0)
 {
     auto lRet = fopen_s(&mFile, aFileName, "rb");
     KMS_EXCEPTION_ASSERT(0 == lRet, RESULT_OPEN_FAILED, "Cannot open input file", aFileName);
@@ -32,39 +32,73 @@ Parser::~Parser()
     (void)lRet;
 }
 
+unsigned int Parser::GetLineNo() const { return mLineNo; }
+
 bool Parser::GetNextLine(char* aOut, unsigned int aOutSize_byte)
 {
     assert(nullptr != aOut);
     assert(0 < aOutSize_byte);
 
-    assert(nullptr != mFile);
+    unsigned int lStart;
+
+    if (!ReadLine(&lStart))
+    {
+        return false;
+    }
 
-    char lLine[LINE_LENGTH];
+    strcpy_s(aOut SizeInfoV(aOutSize_byte), mLine + lStart);
+    return true;
+}
 
-    if (nullptr != fgets(lLine, sizeof(lLine), mFile))
+bool Parser::GetNextLine_Raw(char* aOut, unsigned int aOutSize_byte)
+{
+    assert(nullptr != aOut);
+    assert(0 < aOutSize_byte);
+
+    unsigned int lStart;
+
+    if (!ReadLine(&lStart))
     {
+        return false;
+    }
+
+    strcpy_s(aOut SizeInfoV(aOutSize_byte), mLine);
+    return true;
+}
+
+// Private
+// //////////////////////////////////////////////////////////////////////////
+
+bool Parser::ReadLine(unsigned int* aStart)
+{
+    assert(nullptr != aStart);
+
+    assert(nullptr != mFile);
+
+    while (nullptr != fgets(mLine, sizeof(mLine), mFile))
+    {
+        mLineNo++;
+
+        // Remove the end of line
+        auto lLen = strlen(mLine);
+        while ((0 < lLen) && (('\n' == mLine[lLen - 1]) || ('\r' == mLine[lLen - 1])))
+        {
+            lLen--;
+            mLine[lLen] = '\0';
+        }
+
         unsigned int lStart = 0;
 
-        for (;;)
+        while ((' ' == mLine[lStart]) || ('\t' == mLine[lStart]))
+        {
+            lStart++;
+        }
+
+        // Skip the empty lines and the comments
+        if (('\0' != mLine[lStart]) && ('#' != mLine[lStart]))
         {
-            switch (lLine[lStart])
-            {
-            case '\0':
-            case '\n':
-            case '\r':
-            case '#':
-                // The line is empty or a comment
-                return GetNextLine(aOut, aOutSize_byte);
-
-            case ' ':
-            case '\t':
-                lStart++;
-                break;
-
-            default:
-                strcpy_s(aOut SizeInfoV(aOutSize_byte), lLine + lStart);
-                return true;
-            }
+            *aStart = lStart;
+            return true;
         }
     }
 
@@ -0,0 +1,669 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/PatternSet.cpp
+
+#include "Component.h"
+
+// ===== C++ ================================================================
+#include <algorithm>
+
+// ===== Local ==============================================================
+#include "../Common/PatternSet.h"
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+// Return  false if the escape sequence does not represent a single character
+static bool GetEscapeChar(char aC, unsigned char* aOut);
+
+static bool IsQuantifier(char aC);
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+const unsigned int PatternSet::NO_STATE = 0xffffffff;
+
+PatternSet::PatternSet() : mPtr(nullptr), mCount(0), mMark(0) {}
+
+unsigned int PatternSet::Add(const char* aRegEx)
+{
+    assert(nullptr != aRegEx);
+
+    auto lResult = mCount;
+
+    // The deterministic states do not know the new expression
+    mDStates.clear();
+    mDStates_ByNFA.clear();
+
+    auto lStateCount = mStates.size();
+
+    mPtr = aRegEx;
+
+    if ('^' == *mPtr)
+    {
+        mPtr++;
+    }
+
+    Fragment lF;
+
+    auto lOK = Compile_Alt(&lF);
+    if (lOK && ('$' == *mPtr))
+    {
+        mPtr++;
+    }
+
+    if (lOK && ('\0' == *mPtr))
+    {
+        auto lAccept = AddState(TYPE_ACCEPT);
+
+        mStates[lAccept].mPattern = lResult;
+
+        Patch(lF.mOuts, lAccept);
+
+        mStarts.push_back(lF.mStart);
+    }
+    else
+    {
+        mStates.resize(lStateCount);
+
+        // std::regex reports the invalid expressions
+        mFallbacks.push_back(std::make_pair(lResult, std::regex(aRegEx)));
+    }
+
+    mPtr = nullptr;
+
+    mCount++;
+
+    return lResult;
+}
+
+void PatternSet::Clear()
+{
+    mCount = 0;
+    mMark  = 0;
+
+    mDStates      .clear();
+    mDStates_ByNFA.clear();
+    mFallbacks    .clear();
+    mMarks        .clear();
+    mStarts       .clear();
+    mStates       .clear();
+}
+
+unsigned int PatternSet::GetCount() const { return mCount; }
+
+void PatternSet::Match(const char* aName, std::vector<unsigned int>* aOut)
+{
+    assert(nullptr != aName);
+    assert(nullptr != aOut);
+
+    aOut->clear();
+
+    if (!mStarts.empty())
+    {
+        if (mDStates.empty())
+        {
+            std::vector<unsigned int> lSet;
+
+            NewMark();
+
+            for (auto lStart : mStarts)
+            {
+                AddClosure(&lSet, lStart);
+            }
+
+            auto lDState = GetDState(&lSet);
+            assert(0 == lDState);
+            (void)lDState;
+        }
+
+        unsigned int lDState = 0;
+
+        for (auto lPtr = aName; ('\0' != *lPtr) && !mDStates[lDState].mNFA.empty(); lPtr++)
+        {
+            lDState = Step(lDState, static_cast<unsigned char>(*lPtr));
+        }
+
+        *aOut = mDStates[lDState].mPatterns;
+    }
+
+    if (!mFallbacks.empty())
+    {
+        for (const auto& lFallback : mFallbacks)
+        {
+            if (std::regex_match(aName, lFallback.second))
+            {
+                aOut->push_back(lFallback.first);
+            }
+        }
+
+        std::sort(aOut->begin(), aOut->end());
+    }
+}
+
+// Private
+// //////////////////////////////////////////////////////////////////////////
+
+unsigned int PatternSet::AddState(Type aType)
+{
+    auto lResult = static_cast<unsigned int>(mStates.size());
+
+    State lState;
+
+    lState.mType     = aType;
+    lState.mNext[0]  = NO_STATE;
+    lState.mNext[1]  = NO_STATE;
+    lState.mPattern  = 0;
+
+    mStates.push_back(lState);
+
+    return lResult;
+}
+
+void PatternSet::Patch(const std::vector<unsigned int>& aOuts, unsigned int aState)
+{
+    for (auto lOut : aOuts)
+    {
+        assert(mStates.size() > lOut / 2);
+
+        mStates[lOut / 2].mNext[lOut % 2] = aState;
+    }
+}
+
+// ===== Compilation ========================================================
+
+bool PatternSet::Compile_Alt(Fragment* aOut)
+{
+    assert(nullptr != aOut);
+
+    if (!Compile_Concat(aOut))
+    {
+        return false;
+    }
+
+    while ('|' == *mPtr)
+    {
+        mPtr++;
+
+        Fragment lF;
+
+        if (!Compile_Concat(&lF))
+        {
+            return false;
+        }
+
+        auto lSplit = AddState(TYPE_SPLIT);
+
+        mStates[lSplit].mNext[0] = aOut->mStart;
+        mStates[lSplit].mNext[1] = lF.mStart;
+
+        aOut->mStart = lSplit;
+        aOut->mOuts.insert(aOut->mOuts.end(), lF.mOuts.begin(), lF.mOuts.end());
+    }
+
+    return true;
+}
+
+bool PatternSet::Compile_Atom(Fragment* aOut)
+{
+    assert(nullptr != aOut);
+
+    CharSet lChars;
+
+    switch (*mPtr)
+    {
+    case '(':
+        mPtr++;
+        if ('?' == *mPtr)
+        {
+            // Only the non capturing group is supported
+            if (':' != mPtr[1])
+            {
+                return false;
+            }
+            mPtr += 2;
+        }
+        if ((!Compile_Alt(aOut)) || (')' != *mPtr))
+        {
+            return false;
+        }
+        mPtr++;
+        return true;
+
+    case '.':
+        lChars.set();
+        lChars.reset('\n');
+        lChars.reset('\r');
+        mPtr++;
+        break;
+
+    case '[':
+        mPtr++;
+        if (!Compile_Class(&lChars))
+        {
+            return false;
+        }
+        break;
+
+    case '\\':
+        mPtr++;
+        if (!Compile_Escape(&lChars))
+        {
+            return false;
+        }
+        break;
+
+    case '$':
+    case '^':
+    case ']':
+    case '{':
+    case '}':
+        return false;
+
+    default:
+        if (IsQuantifier(*mPtr))
+        {
+            return false;
+        }
+        lChars.set(static_cast<unsigned char>(*mPtr));
+        mPtr++;
+    }
+
+    auto lState = AddState(TYPE_CHAR);
+
+    mStates[lState].mChars = lChars;
+
+    aOut->mStart = lState;
+    aOut->mOuts.assign(1, lState * 2);
+
+    return true;
+}
+
+bool PatternSet::Compile_Class(CharSet* aOut)
+{
+    assert(nullptr != aOut);
+
+    auto lNot = '^' == *mPtr;
+    if (lNot)
+    {
+        mPtr++;
+    }
+
+    while (']' != *mPtr)
+    {
+        unsigned char lFirst;
+
+        switch (*mPtr)
+        {
+        case '\0': return false;
+
+        case '[':
+            // [:alpha:] and the other named classes
+            if ((':' == mPtr[1]) || ('=' == mPtr[1]) || ('.' == mPtr[1]))
+            {
+                return false;
+            }
+            lFirst = '[';
+            mPtr++;
+            break;
+
+        case '\\':
+            mPtr++;
+            if (!GetEscapeChar(*mPtr, &lFirst))
+            {
+                CharSet lChars;
+
+                if ((!Compile_Escape(&lChars)) || ('-' == *mPtr))
+                {
+                    return false;
+                }
+
+                *aOut |= lChars;
+                continue;
+            }
+            mPtr++;
+            break;
+
+        default:
+            lFirst = static_cast<unsigned char>(*mPtr);
+            mPtr++;
+        }
+
+        if (('-' == *mPtr) && (']' != mPtr[1]))
+        {
+            mPtr++;
+
+            unsigned char lLast;
+
+            switch (*mPtr)
+            {
+            case '\0': return false;
+
+            case '\\':
+                mPtr++;
+                if (!GetEscapeChar(*mPtr, &lLast))
+                {
+                    return false;
+                }
+                break;
+
+            default: lLast = static_cast<unsigned char>(*mPtr);
+            }
+
+            mPtr++;
+
+            if (lFirst > lLast)
+            {
+                return false;
+            }
+
+            for (unsigned int c = lFirst; c <= lLast; c++)
+            {
+                aOut->set(c);
+            }
+        }
+        else
+        {
+            aOut->set(lFirst);
+        }
+    }
+
+    mPtr++;
+
+    if (lNot)
+    {
+        aOut->flip();
+    }
+
+    return true;
+}
+
+bool PatternSet::Compile_Concat(Fragment* aOut)
+{
+    assert(nullptr != aOut);
+
+    auto lEmpty = true;
+
+    for (;;)
+    {
+        auto lC = *mPtr;
+
+        // The $ ending the expression is handled by Add
+        if (('\0' == lC) || ('|' == lC) || (')' == lC) || (('$' == lC) && ('\0' == mPtr[1])))
+        {
+            break;
+        }
+
+        Fragment lF;
+
+        if (!Compile_Repeat(&lF))
+        {
+            return false;
+        }
+
+        if (lEmpty)
+        {
+            *aOut = lF;
+            lEmpty = false;
+        }
+        else
+        {
+            Patch(aOut->mOuts, lF.mStart);
+            aOut->mOuts.swap(lF.mOuts);
+        }
+    }
+
+    if (lEmpty)
+    {
+        auto lState = AddState(TYPE_SPLIT);
+
+        aOut->mStart = lState;
+        aOut->mOuts.assign(1, lState * 2);
+    }
+
+    return true;
+}
+
+bool PatternSet::Compile_Escape(CharSet* aOut)
+{
+    assert(nullptr != aOut);
+
+    unsigned char lC;
+
+    if (GetEscapeChar(*mPtr, &lC))
+    {
+        aOut->set(lC);
+    }
+    else
+    {
+        switch (tolower(*mPtr))
+        {
+        case 'd':
+            for (lC = '0'; lC <= '9'; lC++) { aOut->set(lC); }
+            break;
+
+        case 's':
+            aOut->set(' ');
+            for (lC = '\t'; lC <= '\r'; lC++) { aOut->set(lC); }
+            break;
+
+        case 'w':
+            for (lC = '0'; lC <= '9'; lC++) { aOut->set(lC); }
+            for (lC = 'A'; lC <= 'Z'; lC++) { aOut->set(lC); }
+            for (lC = 'a'; lC <= 'z'; lC++) { aOut->set(lC); }
+            aOut->set('_');
+            break;
+
+        default: return false;
+        }
+
+        if (isupper(*mPtr))
+        {
+            aOut->flip();
+        }
+    }
+
+    mPtr++;
+
+    return true;
+}
+
+bool PatternSet::Compile_Repeat(Fragment* aOut)
+{
+    assert(nullptr != aOut);
+
+    if (!Compile_Atom(aOut))
+    {
+        return false;
+    }
+
+    auto lQ = *mPtr;
+
+    if (('*' == lQ) || ('+' == lQ) || ('?' == lQ))
+    {
+        mPtr++;
+
+        // The lazy form gives the same result when the whole name must match
+        if ('?' == *mPtr)
+        {
+            mPtr++;
+        }
+
+        auto lSplit = AddState(TYPE_SPLIT);
+
+        mStates[lSplit].mNext[0] = aOut->mStart;
+
+        switch (lQ)
+        {
+        case '*':
+            Patch(aOut->mOuts, lSplit);
+            aOut->mStart = lSplit;
+            aOut->mOuts.assign(1, lSplit * 2 + 1);
+            break;
+
+        case '+':
+            Patch(aOut->mOuts, lSplit);
+            aOut->mOuts.assign(1, lSplit * 2 + 1);
+            break;
+
+        case '?':
+            aOut->mStart = lSplit;
+            aOut->mOuts.push_back(lSplit * 2 + 1);
+            break;
+
+        default: assert(false);
+        }
+    }
+
+    // {n,m} is not supported and std::regex reports the other errors
+    return (!IsQuantifier(*mPtr)) && ('{' != *mPtr);
+}
+
+// ===== Execution ==========================================================
+
+void PatternSet::AddClosure(std::vector<unsigned int>* aSet, unsigned int aState)
+{
+    assert(nullptr != aSet);
+
+    std::vector<unsigned int> lStack(1, aState);
+
+    while (!lStack.empty())
+    {
+        auto lIndex = lStack.back();
+        lStack.pop_back();
+
+        if ((NO_STATE == lIndex) || (mMark == mMarks[lIndex]))
+        {
+            continue;
+        }
+
+        mMarks[lIndex] = mMark;
+
+        const auto& lState = mStates[lIndex];
+
+        if (TYPE_SPLIT == lState.mType)
+        {
+            lStack.push_back(lState.mNext[1]);
+            lStack.push_back(lState.mNext[0]);
+        }
+        else
+        {
+            aSet->push_back(lIndex);
+        }
+    }
+}
+
+unsigned int PatternSet::GetDState(std::vector<unsigned int>* aSet)
+{
+    assert(nullptr != aSet);
+
+    std::sort(aSet->begin(), aSet->end());
+
+    auto lIt = mDStates_ByNFA.find(*aSet);
+    if (mDStates_ByNFA.end() != lIt)
+    {
+        return lIt->second;
+    }
+
+    auto lResult = static_cast<unsigned int>(mDStates.size());
+
+    mDStates.push_back(DState());
+
+    auto& lDState = mDStates.back();
+
+    for (auto lIndex : *aSet)
+    {
+        if (TYPE_ACCEPT == mStates[lIndex].mType)
+        {
+            lDState.mPatterns.push_back(mStates[lIndex].mPattern);
+        }
+    }
+
+    std::sort(lDState.mPatterns.begin(), lDState.mPatterns.end());
+
+    for (auto& lNext : lDState.mNext)
+    {
+        lNext = NO_STATE;
+    }
+
+    lDState.mNFA = *aSet;
+
+    mDStates_ByNFA.insert(std::make_pair(*aSet, lResult));
+
+    return lResult;
+}
+
+void PatternSet::NewMark()
+{
+    if (mMarks.size() != mStates.size())
+    {
+        mMarks.assign(mStates.size(), 0);
+        mMark = 0;
+    }
+
+    mMark++;
+}
+
+unsigned int PatternSet::Step(unsigned int aDState, unsigned char aC)
+{
+    assert(mDStates.size() > aDState);
+
+    auto lResult = mDStates[aDState].mNext[aC];
+    if (NO_STATE == lResult)
+    {
+        std::vector<unsigned int> lSet;
+
+        NewMark();
+
+        for (auto lIndex : mDStates[aDState].mNFA)
+        {
+            const auto& lState = mStates[lIndex];
+
+            if ((TYPE_CHAR == lState.mType) && lState.mChars.test(aC))
+            {
+                AddClosure(&lSet, lState.mNext[0]);
+            }
+        }
+
+        lResult = GetDState(&lSet);
+
+        // GetDState may move the states
+        mDStates[aDState].mNext[aC] = lResult;
+    }
+
+    return lResult;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+bool GetEscapeChar(char aC, unsigned char* aOut)
+{
+    assert(nullptr != aOut);
+
+    switch (aC)
+    {
+    case '\0': return false;
+
+    case 'f': *aOut = '\f'; break;
+    case 'n': *aOut = '\n'; break;
+    case 'r': *aOut = '\r'; break;
+    case 't': *aOut = '\t'; break;
+    case 'v': *aOut = '\v'; break;
+
+    default:
+        // \b, the back references, \x, \u, \c and the classes
+        if (isalnum(static_cast<unsigned char>(aC)))
+        {
+            return false;
+        }
+        *aOut = static_cast<unsigned char>(aC);
+    }
+
+    return true;
+}
+
+bool IsQuantifier(char aC) { return ('*' == aC) || ('+' == aC) || ('?' == aC); }
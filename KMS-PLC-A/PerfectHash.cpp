@@ -0,0 +1,182 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/PerfectHash.cpp
+
+#include "Component.h"
+
+// ===== C++ ================================================================
+#include <algorithm>
+
+// ===== Local ==============================================================
+#include "../Common/PerfectHash.h"
+
+using namespace KMS;
+
+// Data type and constants
+// //////////////////////////////////////////////////////////////////////////
+
+// The average number of names per bucket
+#define BUCKET_SIZE (4)
+
+#define FNV_OFFSET (0x811c9dc5)
+#define FNV_PRIME  (0x01000193)
+
+#define SEED_MAX (0x100000)
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+const unsigned int PerfectHash::NO_NAME = 0xffffffff;
+
+uint32_t PerfectHash::Hash(const char* aName, uint32_t aSeed)
+{
+    assert(nullptr != aName);
+
+    uint32_t lResult = FNV_OFFSET ^ aSeed;
+
+    for (auto lC = reinterpret_cast<const uint8_t*>(aName); '\0' != *lC; lC++)
+    {
+        lResult ^= *lC;
+        lResult *= FNV_PRIME;
+    }
+
+    return lResult;
+}
+
+void PerfectHash::Build(const std::vector<const char*>& aNames)
+{
+    mNames = aNames;
+
+    auto lCount = static_cast<unsigned int>(mNames.size());
+
+    // Two identical names never receive different slots
+    std::vector<const char*> lSorted(mNames);
+
+    std::sort(lSorted.begin(), lSorted.end(), [](const char* aA, const char* aB) { return 0 > strcmp(aA, aB); });
+
+    for (unsigned int i = 1; i < lCount; i++)
+    {
+        KMS_EXCEPTION_ASSERT(0 != strcmp(lSorted[i - 1], lSorted[i]), RESULT_INVALID_CONFIG, "Duplicated name", lSorted[i]);
+    }
+
+    // An empty table still has a bucket and a slot, so the lookup does not
+    // need a special case.
+    auto lBucketCount = lCount / BUCKET_SIZE + 1;
+    auto lSlotCount   = (0 < lCount) ? lCount : 1;
+
+    std::vector<std::vector<unsigned int>> lBuckets(lBucketCount);
+
+    for (unsigned int i = 0; i < lCount; i++)
+    {
+        lBuckets[Hash(mNames[i], 0) % lBucketCount].push_back(i);
+    }
+
+    std::vector<unsigned int> lOrder(lBucketCount);
+
+    for (unsigned int b = 0; b < lBucketCount; b++)
+    {
+        lOrder[b] = b;
+    }
+
+    std::stable_sort(lOrder.begin(), lOrder.end(), [&lBuckets](unsigned int aA, unsigned int aB) { return lBuckets[aA].size() > lBuckets[aB].size(); });
+
+    std::vector<unsigned int> lPlaced;
+
+    // With as many slots as names, a seed almost always exists. When the
+    // search fails, a larger table is tried.
+    for (;;)
+    {
+        mSeeds.assign(lBucketCount, 0);
+        mSlots.assign(lSlotCount, NO_NAME);
+
+        auto lOK = true;
+
+        for (auto b : lOrder)
+        {
+            const auto& lBucket = lBuckets[b];
+            if (lBucket.empty())
+            {
+                break;
+            }
+
+            uint32_t lSeed;
+
+            for (lSeed = 1; lSeed < SEED_MAX; lSeed++)
+            {
+                if (Place(lBucket, lSeed, &lPlaced))
+                {
+                    break;
+                }
+            }
+
+            if (SEED_MAX <= lSeed)
+            {
+                lOK = false;
+                break;
+            }
+
+            mSeeds[b] = lSeed;
+        }
+
+        if (lOK)
+        {
+            break;
+        }
+
+        lSlotCount++;
+    }
+}
+
+unsigned int PerfectHash::Find(const char* aName) const
+{
+    assert(nullptr != aName);
+    assert(!mSeeds.empty());
+
+    auto lSeed = mSeeds[Hash(aName, 0) % mSeeds.size()];
+    auto lName = mSlots[Hash(aName, lSeed) % mSlots.size()];
+
+    return ((NO_NAME != lName) && (0 == strcmp(mNames[lName], aName))) ? lName : NO_NAME;
+}
+
+unsigned int PerfectHash::GetBucketCount() const { return static_cast<unsigned int>(mSeeds.size()); }
+
+const std::vector<uint32_t>    & PerfectHash::GetSeeds() const { return mSeeds; }
+const std::vector<unsigned int>& PerfectHash::GetSlots() const { return mSlots; }
+
+// Private
+// //////////////////////////////////////////////////////////////////////////
+
+// Two names of the same bucket can also fall in the same slot, so the slots
+// are only taken once all the names found a free one.
+//
+// aPlaced  Working memory
+bool PerfectHash::Place(const std::vector<unsigned int>& aBucket, uint32_t aSeed, std::vector<unsigned int>* aPlaced)
+{
+    assert(nullptr != aPlaced);
+
+    auto lSlotCount = static_cast<unsigned int>(mSlots.size());
+
+    aPlaced->clear();
+
+    for (auto lName : aBucket)
+    {
+        auto lSlot = Hash(mNames[lName], aSeed) % lSlotCount;
+
+        if ((NO_NAME != mSlots[lSlot]) || (aPlaced->end() != std::find(aPlaced->begin(), aPlaced->end(), lSlot)))
+        {
+            return false;
+        }
+
+        aPlaced->push_back(lSlot);
+    }
+
+    for (unsigned int i = 0; i < aBucket.size(); i++)
+    {
+        mSlots[(*aPlaced)[i]] = aBucket[i];
+    }
+
+    return true;
+}
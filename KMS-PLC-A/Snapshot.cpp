@@ -0,0 +1,236 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/Snapshot.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/Version.h"
+
+#include "../Common/Snapshot.h"
+
+#include "Utilities.h"
+
+using namespace KMS;
+
+// Data type and constants
+// //////////////////////////////////////////////////////////////////////////
+
+typedef struct
+{
+    uint32_t mMagic;
+    uint32_t mVersion;
+    uint64_t mToolHash;
+    uint64_t mKeyHash;
+    uint32_t mReserved0;
+    uint32_t mDataSize_byte;
+    uint64_t mDataHash;
+}
+SnapshotHeader;
+
+static const uint32_t SNAPSHOT_MAGIC   = 0x504e5353; // "SSNP"
+static const uint32_t SNAPSHOT_VERSION = 2;
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static void InitHeader(SnapshotHeader* aOut, const uint64_t* aKey, unsigned int aKeyCount, const uint8_t* aData, unsigned int aDataSize_byte);
+
+// Public
+// //////////////////////////////////////////////////////////////////////////
+
+SnapshotWriter::SnapshotWriter(std::vector<uint8_t>* aOut) : mOut(aOut)
+{
+    assert(nullptr != aOut);
+}
+
+void SnapshotWriter::Add_Data(const void* aIn, unsigned int aSize_byte)
+{
+    assert((nullptr != aIn) || (0 == aSize_byte));
+
+    auto lIn = reinterpret_cast<const uint8_t*>(aIn);
+
+    mOut->insert(mOut->end(), lIn, lIn + aSize_byte);
+}
+
+// The null character is written, so the reader returns the string
+// without copying it.
+void SnapshotWriter::Add_String(const char* aString)
+{
+    assert(nullptr != aString);
+
+    auto lLength = static_cast<unsigned int>(strlen(aString));
+
+    Add_UInt(lLength);
+
+    mOut->insert(mOut->end(), aString, aString + lLength + 1);
+}
+
+void SnapshotWriter::Add_UInt(unsigned int aValue)
+{
+    auto lValue = static_cast<uint32_t>(aValue);
+
+    Add_Data(&lValue, sizeof(lValue));
+}
+
+void SnapshotWriter::Add_WString(const std::wstring& aString)
+{
+    auto lLength = static_cast<unsigned int>(aString.size());
+
+    Add_UInt(lLength);
+    Add_Data(aString.c_str(), lLength * sizeof(wchar_t));
+}
+
+SnapshotReader::SnapshotReader(const uint8_t* aData, unsigned int aSize_byte)
+    : mData(aData), mOffset_byte(0), mSize_byte(aSize_byte)
+{
+    assert((nullptr != aData) || (0 == aSize_byte));
+}
+
+unsigned int SnapshotReader::GetOffset_byte() const { return mOffset_byte; }
+
+bool SnapshotReader::IsAtEnd() const { return mSize_byte <= mOffset_byte; }
+
+const uint8_t* SnapshotReader::Get_Data(unsigned int aSize_byte)
+{
+    Verify(aSize_byte);
+
+    auto lResult = mData + mOffset_byte;
+
+    mOffset_byte += aSize_byte;
+
+    return lResult;
+}
+
+const char* SnapshotReader::Get_String()
+{
+    auto lLength = Get_UInt();
+
+    Verify(lLength + 1);
+
+    auto lResult = reinterpret_cast<const char*>(mData + mOffset_byte);
+
+    KMS_EXCEPTION_ASSERT('\0' == lResult[lLength], RESULT_INVALID_FORMAT, "Invalid snapshot string", lLength);
+
+    mOffset_byte += lLength + 1;
+
+    return lResult;
+}
+
+// The values are not aligned
+unsigned int SnapshotReader::Get_UInt()
+{
+    uint32_t lResult;
+
+    memcpy(&lResult, Get_Data(sizeof(lResult)), sizeof(lResult));
+
+    return lResult;
+}
+
+std::wstring SnapshotReader::Get_WString()
+{
+    auto lLength = Get_UInt();
+
+    KMS_EXCEPTION_ASSERT(mSize_byte / sizeof(wchar_t) >= lLength, RESULT_INVALID_FORMAT, "Invalid snapshot string", lLength);
+
+    std::wstring lResult(lLength, L'\0');
+
+    if (0 < lLength)
+    {
+        memcpy(&lResult[0], Get_Data(lLength * sizeof(wchar_t)), lLength * sizeof(wchar_t));
+    }
+
+    return lResult;
+}
+
+// Private
+// //////////////////////////////////////////////////////////////////////////
+
+void SnapshotReader::Verify(unsigned int aSize_byte) const
+{
+    KMS_EXCEPTION_ASSERT(mSize_byte - mOffset_byte >= aSize_byte, RESULT_INVALID_FORMAT, "Truncated snapshot", aSize_byte);
+}
+
+// Functions
+// //////////////////////////////////////////////////////////////////////////
+
+bool Snapshot_Read(const File::Folder& aFolder, const char* aFileName, const uint64_t* aKey, unsigned int aKeyCount, std::vector<uint8_t>* aOut)
+{
+    assert(nullptr != aFileName);
+    assert(nullptr != aOut);
+
+    aOut->clear();
+
+    if (!aFolder.DoesFileExist(aFileName))
+    {
+        return false;
+    }
+
+    Utl_ReadFile(aFolder, aFileName, aOut);
+
+    SnapshotHeader lHeader;
+
+    if (sizeof(lHeader) > aOut->size())
+    {
+        aOut->clear();
+        return false;
+    }
+
+    memcpy(&lHeader, aOut->data(), sizeof(lHeader));
+
+    auto lData      = aOut->data() + sizeof(lHeader);
+    auto lData_byte = static_cast<unsigned int>(aOut->size() - sizeof(lHeader));
+
+    SnapshotHeader lExpected;
+
+    InitHeader(&lExpected, aKey, aKeyCount, lData, lData_byte);
+
+    if (0 != memcmp(&lExpected, &lHeader, sizeof(lHeader)))
+    {
+        aOut->clear();
+        return false;
+    }
+
+    aOut->erase(aOut->begin(), aOut->begin() + sizeof(lHeader));
+
+    return true;
+}
+
+void Snapshot_Write(const File::Folder& aFolder, const char* aFileName, const uint64_t* aKey, unsigned int aKeyCount, const std::vector<uint8_t>& aData)
+{
+    assert(nullptr != aFileName);
+
+    SnapshotHeader lHeader;
+
+    InitHeader(&lHeader, aKey, aKeyCount, aData.data(), static_cast<unsigned int>(aData.size()));
+
+    std::vector<uint8_t> lFile(sizeof(lHeader));
+
+    memcpy(lFile.data(), &lHeader, sizeof(lHeader));
+
+    lFile.insert(lFile.end(), aData.begin(), aData.end());
+
+    Utl_WriteIfChanged(aFolder, aFileName, lFile);
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+void InitHeader(SnapshotHeader* aOut, const uint64_t* aKey, unsigned int aKeyCount, const uint8_t* aData, unsigned int aDataSize_byte)
+{
+    assert(nullptr != aOut);
+    assert(nullptr != aKey);
+    assert(0 < aKeyCount);
+
+    memset(aOut, 0, sizeof(*aOut));
+
+    aOut->mMagic         = SNAPSHOT_MAGIC;
+    aOut->mVersion       = SNAPSHOT_VERSION;
+    aOut->mToolHash      = Utl_Hash(VERSION_STR, sizeof(VERSION_STR) - 1);
+    aOut->mKeyHash       = Utl_Hash(aKey, aKeyCount * sizeof(uint64_t));
+    aOut->mDataSize_byte = aDataSize_byte;
+    aOut->mDataHash      = Utl_Hash(aData, aDataSize_byte);
+}
@@ -11,6 +11,7 @@
 
 // ===== Import/Includes ====================================================
 #include <KMS/CLI/CommandLine.h>
+#include <KMS/Cfg/MetaData.h>
 #include <KMS/Main.h>
 
 // ===== Local ==============================================================
@@ -18,6 +19,8 @@
 
 #include "EBPro/Address.h"
 
+#include "DepFile.h"
+
 using namespace KMS;
 
 //
@@ -25,9 +28,19 @@ using namespace KMS;
 
 #define CONFIG_FILE ("KMS-PLC.cfg")
 
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const Cfg::MetaData MD_DEP_FILE("DepFile = {Path}.d");
+
 // Public
 // //////////////////////////////////////////////////////////////////////////
 
+const char* System::DEP_FILE_DEFAULT = "";
+
+const unsigned int System::PROJECT_EBPRO   = 0x00000001;
+const unsigned int System::PROJECT_TRILOGI = 0x00000002;
+
 int System::Main(int aCount, const char** aVector)
 {
     KMS_MAIN_BEGIN;
@@ -38,6 +51,11 @@ int System::Main(int aCount, const char** aVector)
 
         lConfigurator.ParseFile(File::Folder::CURRENT, CONFIG_FILE);
 
+        if (File::Folder::CURRENT.DoesFileExist(CONFIG_FILE))
+        {
+            DepFile::AddInput(CONFIG_FILE);
+        }
+
         KMS_MAIN_PARSE_ARGS(aCount, aVector);
 
         KMS_MAIN_VALIDATE;
@@ -49,30 +67,51 @@ int System::Main(int aCount, const char** aVector)
     KMS_MAIN_RETURN;
 }
 
-System::System() : mMacros(this)
+System::System() : mDepFile(DEP_FILE_DEFAULT), mMacros(this), mLoaded(0)
 {
+    DepFile::Clear();
+
     Ptr_OF<DI::Object> lEntry;
 
+    lEntry.Set(&mDepFile, false); AddEntry("DepFile", lEntry, &MD_DEP_FILE);
+
     lEntry.Set(&mEBPro  , false); AddEntry("EBPro"  , lEntry);
     lEntry.Set(&mTRiLOGI, false); AddEntry("TRiLOGI", lEntry);
 
     AddModule(&mMacros);
 }
 
-void System::Clean() { mTRiLOGI.Clean(); }
+void System::Clean()
+{
+    Load(PROJECT_TRILOGI);
+
+    mTRiLOGI.Clean();
+}
+
+// NOT TESTED
+void System::Edit_emtp() { mEBPro.Edit(); }
 
 // NOT TESTED
-void System::Edit_emtp() { mEBPro  .Edit(); }
-void System::Edit_PC6 () { mTRiLOGI.Edit(); }
+void System::Edit_PC6()
+{
+    // Edit reads and parses the file again after the edition
+    mTRiLOGI.Edit();
+
+    mLoaded |= PROJECT_TRILOGI;
+}
 
 void System::Export()
 {
+    Load(PROJECT_EBPRO | PROJECT_TRILOGI);
+
     mEBPro  .Export();
     mTRiLOGI.Export();
 }
 
 void System::Import()
 {
+    Load(PROJECT_EBPRO | PROJECT_TRILOGI);
+
     mEBPro  .Import();
     mTRiLOGI.Import();
 
@@ -83,22 +122,63 @@ void System::Import()
     }
 }
 
-void System::Parse()
+void System::Load(unsigned int aProjects)
 {
-    mEBPro  .Parse();
-    mTRiLOGI.Parse();
+    auto lToLoad = aProjects & ~mLoaded;
+
+    if (0 != (lToLoad & PROJECT_EBPRO))
+    {
+        mEBPro.Read ();
+        mEBPro.Parse();
+    }
+
+    if (0 != (lToLoad & PROJECT_TRILOGI))
+    {
+        mTRiLOGI.Read ();
+        mTRiLOGI.Parse();
+    }
+
+    mLoaded |= lToLoad;
 }
 
 void System::Program_PLC() { mTRiLOGI.Program(); }
 
-void System::Read()
+void System::Relocate_Words()
 {
-    mEBPro  .Read();
-    mTRiLOGI.Read();
+    if (!mTRiLOGI.IsImported())
+    {
+        Import();
+    }
+
+    mTRiLOGI.Relocate_Words();
+
+    const AddressList* lAL = mTRiLOGI.GetPublicAddresses();
+    if ((nullptr != lAL) && (0 < lAL->size()))
+    {
+        mEBPro.Import(*lAL);
+    }
+}
+
+void System::Report_ScanTime()
+{
+    Load(PROJECT_TRILOGI);
+
+    mTRiLOGI.Report_ScanTime();
+}
+
+// NOT TESTED
+void System::Restore_PC6(const char* aDelta)
+{
+    // Restore reads and parses the file again
+    mTRiLOGI.Restore(aDelta);
+
+    mLoaded |= PROJECT_TRILOGI;
 }
 
 void System::Verify()
 {
+    Load(PROJECT_EBPRO | PROJECT_TRILOGI);
+
     mEBPro  .Verify();
     mTRiLOGI.Verify();
 
@@ -137,7 +217,12 @@ void System::Verify()
     }
 }
 
-void System::Write() { mTRiLOGI.Write(); }
+void System::Write()
+{
+    Load(PROJECT_TRILOGI);
+
+    mTRiLOGI.Write();
+}
 
 // ===== CLI::Tool ==========================================================
 
@@ -151,6 +236,9 @@ void System::DisplayHelp(FILE* aOut) const
         "Export\n"
         "Import\n"
         "Program PLC\n"
+        "Relocate Words\n"
+        "Report ScanTime\n"
+        "Restore PC6 {Delta}\n"
         "Verify\n"
         "Write\n");
 
@@ -165,13 +253,16 @@ int System::ExecuteCommand(CLI::CommandLine* aCmd)
 
     auto lCmd = aCmd->GetCurrent();
 
-    if      (0 == _stricmp("Clean"  , lCmd)) { aCmd->Next(); lResult = Cmd_Clean  (aCmd); }
-    else if (0 == _stricmp("Edit"   , lCmd)) { aCmd->Next(); lResult = Cmd_Edit   (aCmd); }
-    else if (0 == _stricmp("Export" , lCmd)) { aCmd->Next(); lResult = Cmd_Export (aCmd); }
-    else if (0 == _stricmp("Import" , lCmd)) { aCmd->Next(); lResult = Cmd_Import (aCmd); }
-    else if (0 == _stricmp("Program", lCmd)) { aCmd->Next(); lResult = Cmd_Program(aCmd); }
-    else if (0 == _stricmp("Verify" , lCmd)) { aCmd->Next(); lResult = Cmd_Verify (aCmd); }
-    else if (0 == _stricmp("Write"  , lCmd)) { aCmd->Next(); lResult = Cmd_Write  (aCmd); }
+    if      (0 == _stricmp("Clean"   , lCmd)) { aCmd->Next(); lResult = Cmd_Clean   (aCmd); }
+    else if (0 == _stricmp("Edit"    , lCmd)) { aCmd->Next(); lResult = Cmd_Edit    (aCmd); }
+    else if (0 == _stricmp("Export"  , lCmd)) { aCmd->Next(); lResult = Cmd_Export  (aCmd); }
+    else if (0 == _stricmp("Import"  , lCmd)) { aCmd->Next(); lResult = Cmd_Import  (aCmd); }
+    else if (0 == _stricmp("Program" , lCmd)) { aCmd->Next(); lResult = Cmd_Program (aCmd); }
+    else if (0 == _stricmp("Relocate", lCmd)) { aCmd->Next(); lResult = Cmd_Relocate(aCmd); }
+    else if (0 == _stricmp("Report"  , lCmd)) { aCmd->Next(); lResult = Cmd_Report  (aCmd); }
+    else if (0 == _stricmp("Restore" , lCmd)) { aCmd->Next(); lResult = Cmd_Restore (aCmd); }
+    else if (0 == _stricmp("Verify"  , lCmd)) { aCmd->Next(); lResult = Cmd_Verify  (aCmd); }
+    else if (0 == _stricmp("Write"   , lCmd)) { aCmd->Next(); lResult = Cmd_Write   (aCmd); }
     else
     {
         lResult = CLI::Tool::ExecuteCommand(aCmd);
@@ -180,12 +271,22 @@ int System::ExecuteCommand(CLI::CommandLine* aCmd)
     return lResult;
 }
 
+// The commands load the projects they use, so a command like Program PLC
+// does not read nor parse the projects.
 int System::Run()
 {
-    Read  ();
-    Parse ();
+    auto lResult = CLI::Tool::Run();
+
+    if (0 < mDepFile.GetLength())
+    {
+        ::Console::Progress_Begin("System", "Writing", mDepFile.Get());
+        {
+            DepFile::Write(mDepFile.Get());
+        }
+        ::Console::Progress_End("Written");
+    }
 
-    return CLI::Tool::Run();
+    return lResult;
 }
 
 // Private
@@ -292,6 +393,96 @@ int System::Cmd_Program_PLC(CLI::CommandLine* aCmd)
     return 0;
 }
 
+int System::Cmd_Relocate(CLI::CommandLine* aCmd)
+{
+    assert(nullptr != aCmd);
+
+    int lResult = __LINE__;
+
+    auto lCmd = aCmd->GetCurrent();
+
+    if (0 == _stricmp("Words", lCmd)) { aCmd->Next(); lResult = Cmd_Relocate_Words(aCmd); }
+    else
+    {
+        KMS_EXCEPTION(RESULT_INVALID_COMMAND, "Invalid Relocate command", lCmd);
+    }
+
+    return 0;
+}
+
+int System::Cmd_Relocate_Words(CLI::CommandLine* aCmd)
+{
+    assert(nullptr != aCmd);
+
+    KMS_EXCEPTION_ASSERT(aCmd->IsAtEnd(), RESULT_INVALID_COMMAND, "Too many arguments for the Relocate Words command", aCmd->GetCurrent());
+
+    Relocate_Words();
+
+    return 0;
+}
+
+int System::Cmd_Report(CLI::CommandLine* aCmd)
+{
+    assert(nullptr != aCmd);
+
+    int lResult = __LINE__;
+
+    auto lCmd = aCmd->GetCurrent();
+
+    if (0 == _stricmp("ScanTime", lCmd)) { aCmd->Next(); lResult = Cmd_Report_ScanTime(aCmd); }
+    else
+    {
+        KMS_EXCEPTION(RESULT_INVALID_COMMAND, "Invalid Report command", lCmd);
+    }
+
+    return 0;
+}
+
+int System::Cmd_Report_ScanTime(CLI::CommandLine* aCmd)
+{
+    assert(nullptr != aCmd);
+
+    KMS_EXCEPTION_ASSERT(aCmd->IsAtEnd(), RESULT_INVALID_COMMAND, "Too many arguments for the Report ScanTime command", aCmd->GetCurrent());
+
+    Report_ScanTime();
+
+    return 0;
+}
+
+int System::Cmd_Restore(CLI::CommandLine* aCmd)
+{
+    assert(nullptr != aCmd);
+
+    int lResult = __LINE__;
+
+    auto lCmd = aCmd->GetCurrent();
+
+    if (0 == _stricmp("PC6", lCmd)) { aCmd->Next(); lResult = Cmd_Restore_PC6(aCmd); }
+    else
+    {
+        KMS_EXCEPTION(RESULT_INVALID_COMMAND, "Invalid Restore command", lCmd);
+    }
+
+    return 0;
+}
+
+int System::Cmd_Restore_PC6(CLI::CommandLine* aCmd)
+{
+    assert(nullptr != aCmd);
+
+    KMS_EXCEPTION_ASSERT(!aCmd->IsAtEnd(), RESULT_INVALID_COMMAND, "The Restore PC6 command needs a delta file", "");
+
+    auto lDelta = aCmd->GetCurrent();
+
+    aCmd->Next();
+
+    KMS_EXCEPTION_ASSERT(aCmd->IsAtEnd(), RESULT_INVALID_COMMAND, "Too many arguments for the Restore PC6 command", aCmd->GetCurrent());
+
+    Restore_PC6(lDelta);
+
+    return 0;
+}
+
 int System::Cmd_Verify(CLI::CommandLine* aCmd)
 {
     assert(nullptr != aCmd);
@@ -28,7 +28,8 @@ namespace TRiLOGI
 
         // ===== Object =====================================================
         virtual ~Constant();
-        virtual void GetLine(wchar_t* aOut, unsigned int aOutSize_byte) const;
+        virtual void WriteRecord(RecordWriter* aWriter) const;
+        virtual void WriteSnapshot(SnapshotWriter* aWriter) const;
 
     private:
 
@@ -15,6 +15,10 @@
 namespace TRiLOGI
 {
 
+    class File_PC6;
+    class Optimizer;
+    class WordRelocation;
+
     class Function : public Object, public ::Function
     {
 
@@ -24,12 +28,21 @@ namespace TRiLOGI
 
         Function(const char* aName, unsigned int aIndex);
 
-        void AddCodeToFile(KMS::Text::File_UTF16* aFile);
+        void AddCodeToFile(File_PC6* aFile);
+
+        using ::Function::GetLine;
+        using ::Function::GetLineCount;
+
+        void Optimize(Optimizer* aOptimizer);
+
+        void Parse(Parser* aParser);
 
-        void Parse(KMS::Text::File_ASCII* aFile, KMS::Text::File_ASCII::Internal::iterator* aIt);
+        // Return  true when the code changed
+        bool RelocateWords(WordRelocation* aRelocation);
 
         // ===== Object =====================================================
         virtual ~Function();
+        virtual void WriteSnapshot(SnapshotWriter* aWriter) const;
 
     private:
 
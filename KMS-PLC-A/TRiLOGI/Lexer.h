@@ -0,0 +1,76 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI/Lexer.h
+
+#pragma once
+
+// ===== Local ==============================================================
+#include "../../Common/Parser.h"
+
+namespace TRiLOGI
+{
+
+    enum class Keyword
+    {
+        ADDRESS = 0,
+        ADDRESSES,
+        CONSTANT,
+        COUNTER,
+        FUNCTION,
+        INPUT,
+        OUTPUT,
+        RELAY,
+        TIMER,
+        WORD,
+
+        INVALID
+    };
+
+    // The Lexer reads a .PC6.txt source file in a single pass. Each line is
+    // split in tokens once, its keyword comes from a constant table and its
+    // arguments are verified against the types the table gives.
+    class Lexer
+    {
+
+    public:
+
+        Lexer(const char* aFileName);
+
+        // Return  false at the end of the file
+        bool GetNextStatement();
+
+        const char * GetArg     (unsigned int aIndex) const;
+        unsigned int GetArg_UInt(unsigned int aIndex) const;
+
+        unsigned int GetArgCount() const;
+
+        Keyword GetKeyword() const;
+
+        const char* GetLine() const;
+
+        unsigned int GetLineNo() const;
+
+        // The FUNCTION statement reads its code directly from the Parser
+        Parser* GetParser();
+
+    private:
+
+        NO_COPY(Lexer);
+
+        void Tokenize();
+
+        Parser mParser;
+
+        const char * mArgs[2];
+        unsigned int mArgCount;
+        unsigned int mArgs_UInt[2];
+        Keyword      mKeyword;
+        char         mLine  [LINE_LENGTH];
+        char         mTokens[LINE_LENGTH];
+
+    };
+
+}
@@ -13,9 +13,15 @@
 // ====== Import/Includes ===================================================
 #include <KMS/Text/File_UTF16.h>
 
+class SnapshotWriter;
+
 namespace TRiLOGI
 {
 
+    class RecordWriter;
+
+    // An Object does not copy its name. The list owning the object keeps
+    // the name in its Arena.
     class Object
     {
 
@@ -38,7 +44,12 @@ namespace TRiLOGI
 
         bool TestFlag(unsigned int aFlag) const;
 
-        virtual void GetLine(wchar_t* aOut, unsigned int aOutSize_byte) const;
+        // The caller begins and ends the line
+        virtual void WriteRecord(RecordWriter* aWriter) const;
+
+        // The list reading the snapshot creates the object using these
+        // values, see ObjectList::ReadSnapshotRecord
+        virtual void WriteSnapshot(SnapshotWriter* aWriter) const;
 
     protected:
 
@@ -48,7 +59,7 @@ namespace TRiLOGI
 
         unsigned int mFlags;
         unsigned int mIndex;
-        std::string  mName;
+        const char * mName;
 
     };
 
@@ -0,0 +1,157 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI/Optimizer.h
+
+#pragma once
+
+// ===== C++ ================================================================
+#include <string>
+#include <vector>
+
+// ===== Local ==============================================================
+#include "../../Common/TRiLOGI/SymbolTable.h"
+
+namespace TRiLOGI
+{
+
+    // The Optimizer rewrites the TBASIC code of the imported functions
+    // before it goes into the PC6 file, because the PLC interprets it at
+    // each scan.
+    //
+    // - A constant with an integer value is replaced with its value.
+    // - An integer expression without variable is replaced with its value.
+    // - An IF block with a constant condition is replaced with the branch
+    //   the PLC executes.
+    //
+    // The value of a constant is the one it has when the function is
+    // imported, so the CONSTANT statements must precede the functions
+    // using them. Changing the value of a constant in i-TRiLOGI does not
+    // change the optimized functions.
+    //
+    // The Optimizer does not rely on the precedence of the bitwise
+    // operators. It folds them only between single operands using the same
+    // operator. A negative result stays as written.
+    //
+    // In minify mode, the comments, the empty lines, the indentation and
+    // the spaces the TBASIC syntax does not need are removed, so the
+    // function uses less program memory. The readable code, before
+    // minification, stays available in the same format as the sources.
+    class Optimizer
+    {
+
+    public:
+
+        Optimizer(const SymbolTable& aSymbols);
+
+        // FUNCTION statements with the code of the minified functions
+        const std::string& GetReadable() const;
+
+        // Default  true
+        void SetFold(bool aFold);
+
+        // Default  false
+        void SetMinify(bool aMinify);
+
+        void DisplayStats() const;
+
+        // Each change is reported
+        //
+        // Return  The number of changes
+        unsigned int Optimize(const char* aFunction, std::vector<std::string>* aLines);
+
+    private:
+
+        NO_COPY(Optimizer);
+
+        enum class TokenType
+        {
+            NAME,
+            NUMBER,
+            OPERATOR,
+            OTHER,
+        };
+
+        typedef struct
+        {
+            TokenType    mType;
+            unsigned int mBegin;
+            unsigned int mEnd;
+            int64_t      mValue;
+        }
+        Token;
+
+        // mEmit is false for the result of a comparison or of a logical
+        // operator, it is known but it does not replace the expression.
+        // mSimple indicates a number, a name or an expression between
+        // parentheses.
+        typedef struct
+        {
+            bool    mConst;
+            bool    mEmit;
+            bool    mSimple;
+            int64_t mValue;
+        }
+        Value;
+
+        // The tokens from mFirst to mEnd (excluded) become the value
+        typedef struct
+        {
+            unsigned int mFirst;
+            unsigned int mEnd;
+            int64_t      mValue;
+        }
+        Replacement;
+
+        // Return  true when the line changed
+        bool Fold(std::string* aLine);
+
+        unsigned int RemoveBranches(const char* aFunction, std::vector<std::string>* aLines);
+
+        // Return  true when the code changed
+        bool Minify(std::vector<std::string>* aLines);
+
+        bool IsName    (unsigned int aToken, const char* aName) const;
+        bool IsOperator(unsigned int aToken, const char* aOperator) const;
+
+        void Record(unsigned int aFirst, int64_t aValue);
+
+        void DropFolds(unsigned int aFirst, unsigned int aEnd);
+
+        void Tokenize(const std::string& aLine);
+
+        Value Parse_Or     ();
+        Value Parse_And    ();
+        Value Parse_Not    ();
+        Value Parse_Compare();
+        Value Parse_Bitwise();
+        Value Parse_Add    ();
+        Value Parse_Mul    ();
+        Value Parse_Unary  ();
+        Value Parse_Primary();
+
+        bool mFold;
+        bool mMinify;
+
+        unsigned int mBranchCount;
+        unsigned int mFoldCount;
+        uint64_t     mLength_After;
+        uint64_t     mLength_Before;
+        unsigned int mMinifyCount;
+
+        const std::string* mLine;
+        unsigned int       mPos;
+
+        std::string mReadable;
+
+        std::vector<Replacement> mReplacements;
+
+        const SymbolTable& mSymbols;
+
+        std::vector<Token> mTokens;
+
+    };
+
+}
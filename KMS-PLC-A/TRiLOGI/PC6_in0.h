@@ -20,7 +20,3 @@
 #define PC6_IN0_RELAY     "RELAY"
 #define PC6_IN0_TIMER     "TIMER"
 #define PC6_IN0_WORD      "WORD"
-
-#define PC6_IN0_NAME   "%[0-9A-Za-z_]"
-#define PC6_IN0_STRING "%s"
-#define PC6_IN0_UINT   "%u"
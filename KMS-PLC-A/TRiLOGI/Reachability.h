@@ -0,0 +1,75 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI/Reachability.h
+
+#pragma once
+
+// ===== C++ ================================================================
+#include <unordered_set>
+#include <vector>
+
+// ===== Local ==============================================================
+#include "../../Common/TRiLOGI/SymbolTable.h"
+
+namespace TRiLOGI
+{
+
+    class Function;
+    class FunctionList;
+    class LineList;
+
+    // The Reachability analysis starts from the ladder circuits, which the
+    // PLC scans, and follows the CusFn coils of the circuits and the CALL,
+    // HSCDEF and INTRDEF statements of the reached functions. Unlike the
+    // UsageCounter, a name inside a comment, inside a string or inside a
+    // function nothing reaches is not a use.
+    //
+    // A reached function accessing the relays or the words by address,
+    // using RELAY[...] or DM[...], reaches all of them. A statement giving
+    // the function number using a number or a constant reaches the function
+    // it designates. Using an expression or a variable, it reaches all of
+    // them.
+    class Reachability
+    {
+
+    public:
+
+        Reachability(const SymbolTable& aSymbols, FunctionList* aFunctions);
+
+        void Analyze(const LineList& aCircuits);
+
+        bool IsReached(const Object* aObject, SymbolKind aKind) const;
+
+    private:
+
+        NO_COPY(Reachability);
+
+        void Reach(const char* aName);
+        void Reach(Function* aFunction);
+
+        // aArg  See FunctionList::GetNumber
+        void Reach_Function(const char* aArg);
+
+        void Reach_AllFunctions();
+
+        void Scan_Code   (const char   * aLine);
+        void Scan_Circuit(const wchar_t* aLine);
+
+        bool mAllFunctions;
+        bool mAllRelays;
+        bool mAllWords;
+
+        FunctionList* mFunctions;
+
+        std::unordered_set<const Object*> mReached;
+
+        const SymbolTable& mSymbols;
+
+        std::vector<Function*> mToScan;
+
+    };
+
+}
@@ -26,7 +26,8 @@ namespace TRiLOGI
 
         // ===== Object =====================================================
         virtual ~Timer();
-        virtual void GetLine(wchar_t* aOut, unsigned int aOutSize_byte) const;
+        virtual void WriteRecord(RecordWriter* aWriter) const;
+        virtual void WriteSnapshot(SnapshotWriter* aWriter) const;
 
     private:
 
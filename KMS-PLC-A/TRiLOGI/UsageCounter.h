@@ -0,0 +1,78 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI/UsageCounter.h
+
+#pragma once
+
+// ===== C++ ================================================================
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace TRiLOGI
+{
+
+    class File_PC6;
+
+    // The UsageCounter counts the occurrences of all the object names in a
+    // single pass over the PC6 file. It builds an Aho-Corasick automaton
+    // from the names and replaces one CountOccurrence call per object.
+    //
+    // Like CountOccurrence, an occurrence never spans two lines and the
+    // occurrences of a given name do not overlap. When Count is called for
+    // more than one file, the counts accumulate.
+    class UsageCounter
+    {
+
+    public:
+
+        UsageCounter();
+
+        void AddName(const char* aName);
+
+        void Count(const File_PC6& aFile_PC6);
+
+        unsigned int GetCount(const char* aName) const;
+
+    private:
+
+        NO_COPY(UsageCounter);
+
+        typedef std::map<std::string, unsigned int> PatternMap;
+
+        typedef std::vector<unsigned int> UIntVector;
+
+        void Compile();
+
+        unsigned int GetClass(wchar_t aC) const;
+
+        void Count(const wchar_t* aLine, unsigned int aLineNo);
+
+        unsigned int mClassCount;
+        unsigned int mClasses_ASCII[128];
+        unsigned int mLineCount;
+
+        std::unordered_map<wchar_t, unsigned int> mClasses_Other;
+
+        // ===== Automaton ==================================================
+        UIntVector mDictLinks;
+        UIntVector mGoTo;
+        UIntVector mOutputs;
+
+        // ===== Patterns ===================================================
+        UIntVector mCounts;
+        UIntVector mLastEnds;
+        UIntVector mLastLines;
+        UIntVector mLengths;
+
+        PatternMap mPatterns;
+
+        std::vector<std::wstring> mPatterns_W;
+
+    };
+
+}
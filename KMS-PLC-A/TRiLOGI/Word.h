@@ -22,9 +22,13 @@ namespace TRiLOGI
 
         unsigned int GetOffset() const;
 
+        // The WordList moves the word
+        void SetOffset(unsigned int aOffset);
+
         // ===== Object =====================================================
         virtual ~Word();
-        virtual void GetLine(wchar_t* aOut, unsigned int aOutSize_byte) const;
+        virtual void WriteRecord(RecordWriter* aWriter) const;
+        virtual void WriteSnapshot(SnapshotWriter* aWriter) const;
 
     private:
 
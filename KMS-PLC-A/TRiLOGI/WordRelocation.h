@@ -0,0 +1,64 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI/WordRelocation.h
+
+#pragma once
+
+// ===== C++ ================================================================
+#include <string>
+#include <vector>
+
+namespace TRiLOGI
+{
+
+    // The WordRelocation gives the new offset of the moved words. It
+    // rewrites the DM[n] accesses of a line in one pass, the offset
+    // indexes a table, so the cost does not depend on the number of moved
+    // words. A comment or a string does not change.
+    //
+    // A DM access using an expression, DM[I] or DM[BASE + 1], may access a
+    // moved word. It is counted, not rewritten.
+    class WordRelocation
+    {
+
+    public:
+
+        WordRelocation();
+
+        // aFrom  The previous offset
+        // aTo    The new offset
+        void Add(unsigned int aFrom, unsigned int aTo);
+
+        // The DM accesses Rewrite left as they are because they use an
+        // expression
+        unsigned int GetIndirectCount() const;
+
+        // The DM accesses Rewrite changed
+        unsigned int GetRewriteCount() const;
+
+        // Return  The new offset, 0 when the word did not move
+        unsigned int GetTo(unsigned int aFrom) const;
+
+        // Return  true when the line changed
+        bool Rewrite(std::string * aLine);
+        bool Rewrite(std::wstring* aLine);
+
+    private:
+
+        NO_COPY(WordRelocation);
+
+        template <typename C>
+        bool Rewrite_T(std::basic_string<C>* aLine);
+
+        unsigned int mIndirectCount;
+        unsigned int mRewriteCount;
+
+        // Indexed by the previous offset, 0 for the words not moved
+        std::vector<uint16_t> mTo;
+
+    };
+
+}
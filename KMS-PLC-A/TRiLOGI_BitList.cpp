@@ -22,24 +22,36 @@ namespace TRiLOGI
     // Public
     // //////////////////////////////////////////////////////////////////////
 
-    BitList::BitList(const char* aElementName, unsigned int aStartAddress, unsigned int aMaxQty)
-        : ObjectList(aElementName, aMaxQty), mStartAddress(aStartAddress)
+    BitList::BitList(const char* aElementName, SymbolKind aKind, unsigned int aStartAddress, unsigned int aMaxQty)
+        : TypedList(aElementName, aMaxQty, aKind), mStartAddress(aStartAddress)
     {}
 
-    void BitList::GetAddresses(const std::regex& aRegEx, AddressList* aOut) const
+    void BitList::GetAddresses(PatternSet* aPatterns, std::vector<AddressList>* aOut) const
     {
+        assert(nullptr != aPatterns);
         assert(nullptr != aOut);
 
-        for (auto lVT : mObjects_ByIndex)
+        std::vector<unsigned int> lMatches;
+
+        for (auto lBit : mObjects_ByIndex)
         {
-            auto lBit = lVT.second;
-            assert(nullptr != lBit);
+            if (nullptr == lBit)
+            {
+                continue;
+            }
+
+            if (lBit->TestFlag(Object::FLAG_NOT_USED))
+            {
+                continue;
+            }
 
             auto lN = lBit->GetName();
 
-            if ((!lBit->TestFlag(Object::FLAG_NOT_USED)) && std::regex_match(lN, aRegEx))
+            aPatterns->Match(lN, &lMatches);
+
+            for (auto lPattern : lMatches)
             {
-                aOut->Add(lN, AddressType::MODBUS_RTU_1X, mStartAddress + lBit->GetIndex());
+                (*aOut)[lPattern].Add(lN, AddressType::MODBUS_RTU_1X, mStartAddress + lBit->GetIndex());
             }
         }
     }
@@ -58,7 +70,7 @@ namespace TRiLOGI
 
             auto lIndex = FindFreeIndex();
 
-            lObject = new Object(aName, lIndex, 0);
+            lObject = NewObject<Object>(aName, lIndex, 0);
 
             AddObject(lObject);
         }
@@ -81,7 +93,7 @@ namespace TRiLOGI
                     ::Console::Change("New", GetElementName(), aName);
                 }
 
-                lObject = new Object(aName, aIndex, 0);
+                lObject = NewObject<Object>(aName, aIndex, 0);
 
                 AddObject(lObject);
                 return true;
@@ -10,6 +10,10 @@
 #include "Component.h"
 
 // ===== Local ==============================================================
+#include "../Common/TRiLOGI/RecordWriter.h"
+#include "../Common/Snapshot.h"
+#include "../Common/TRiLOGI/SymbolTable.h"
+
 #include "TRiLOGI/Constant.h"
 
 using namespace KMS;
@@ -24,6 +28,8 @@ namespace TRiLOGI
         : Object(aName, aIndex, 0), mComment(aComment), mValue(aValue)
     {}
 
+    const char* Constant::GetValue() const { return mValue.c_str(); }
+
     bool Constant::SetValue(const char* aValue)
     {
         assert(nullptr != aValue);
@@ -55,25 +61,34 @@ namespace TRiLOGI
 
     Constant::~Constant() {}
 
-    void Constant::GetLine(wchar_t* aOut, unsigned int aOutSize_byte) const
+    void Constant::WriteRecord(RecordWriter* aWriter) const
     {
-        assert(nullptr != aOut);
+        assert(nullptr != aWriter);
 
-        unsigned int lOutLen = aOutSize_byte / sizeof(wchar_t);
+        Object::WriteRecord(aWriter);
 
-        auto lI = GetIndex();
-        auto lN = GetName ();
-        auto lV = mValue.c_str();
+        aWriter->Add(L',');
+        aWriter->Add(mValue.c_str());
 
-        if (mComment.empty())
-        {
-            swprintf_s(aOut SizeInfoV(lOutLen), L"%u,%S,%S", lI, lN, lV);
-        }
-        else
+        if (!mComment.empty())
         {
             // NOT TESTED
-            swprintf_s(aOut SizeInfoV(lOutLen), L"%u,%S,%S,%S", lI, lN, lV, mComment.c_str());
+            aWriter->Add(L',');
+            aWriter->Add(mComment.c_str());
         }
     }
 
+    // The DefineList contains words and constants, the kind comes first
+    void Constant::WriteSnapshot(SnapshotWriter* aWriter) const
+    {
+        assert(nullptr != aWriter);
+
+        aWriter->Add_UInt(static_cast<unsigned int>(SymbolKind::CONSTANT));
+
+        Object::WriteSnapshot(aWriter);
+
+        aWriter->Add_String(mValue  .c_str());
+        aWriter->Add_String(mComment.c_str());
+    }
+
 }
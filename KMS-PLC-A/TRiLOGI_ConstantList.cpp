@@ -14,8 +14,6 @@
 
 #include "TRiLOGI/Constant.h"
 
-KMS_RESULT_STATIC(RESULT_ALREADY_EXIST);
-
 namespace TRiLOGI
 {
 
@@ -26,26 +24,20 @@ namespace TRiLOGI
     {
         assert(nullptr != aConstant);
 
-        auto lBN = mConstants_ByName.insert(ByName::value_type(aConstant->GetName(), aConstant));
-        if (!lBN.second)
-        {
-            char lMsg[64 + NAME_LENGTH];
-            sprintf_s(lMsg, "A constant named \"%s\" already exist (NOT TESTED)", aConstant->GetName());
-            KMS_EXCEPTION(RESULT_ALREADY_EXIST, lMsg, "");
-        }
+        mConstants.push_back(aConstant);
     }
 
-    void ConstantList::ClearList() { mConstants_ByName.clear(); }
+    void ConstantList::ClearList() { mConstants.clear(); }
 
-    unsigned int ConstantList::GetCount() const { return static_cast<unsigned int>(mConstants_ByName.size()); }
+    unsigned int ConstantList::GetCount() const { return static_cast<unsigned int>(mConstants.size()); }
 
     void ConstantList::Verify() const
     {
-        for (auto& lVT : mConstants_ByName)
+        for (auto lConstant : mConstants)
         {
-            assert(nullptr != lVT.second);
+            assert(nullptr != lConstant);
 
-            lVT.second->Verify();
+            lConstant->Verify();
         }
     }
 
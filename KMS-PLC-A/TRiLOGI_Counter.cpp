@@ -10,6 +10,9 @@
 #include "Component.h"
 
 // ===== Local ==============================================================
+#include "../Common/TRiLOGI/RecordWriter.h"
+#include "../Common/Snapshot.h"
+
 #include "TRiLOGI/Counter.h"
 
 using namespace KMS;
@@ -41,11 +44,23 @@ namespace TRiLOGI
 
     Counter::~Counter() {}
 
-    void Counter::GetLine(wchar_t* aOut, unsigned int aOutSize_byte) const
+    void Counter::WriteRecord(RecordWriter* aWriter) const
     {
-        assert(nullptr != aOut);
+        assert(nullptr != aWriter);
+
+        Object::WriteRecord(aWriter);
+
+        aWriter->Add(L' ');
+        aWriter->Add_UInt(mInit);
+    }
+
+    void Counter::WriteSnapshot(SnapshotWriter* aWriter) const
+    {
+        assert(nullptr != aWriter);
+
+        Object::WriteSnapshot(aWriter);
 
-        swprintf_s(aOut SizeInfoV(aOutSize_byte / sizeof(wchar_t)), L"%u,%S %u", GetIndex(), GetName(), mInit);
+        aWriter->Add_UInt(mInit);
     }
 
 }
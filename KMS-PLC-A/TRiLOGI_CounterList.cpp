@@ -22,14 +22,12 @@ namespace TRiLOGI
     // Public
     // //////////////////////////////////////////////////////////////////////
 
-    CounterList::CounterList() : ObjectList("counter", 256) {}
+    CounterList::CounterList() : TypedList("counter", 256, SymbolKind::COUNTER) {}
 
     // Protected
     // //////////////////////////////////////////////////////////////////////
 
-    // ===== ObjectList =====================================================
-
-    void CounterList::AddObject(const wchar_t* aLine, unsigned int)
+    void CounterList::ParseLine(const wchar_t* aLine, unsigned int)
     {
         assert(nullptr != aLine);
 
@@ -40,15 +38,26 @@ namespace TRiLOGI
         auto lRet = swscanf_s(aLine, L"%u,%S %u", &lIndex, lName SizeInfo(lName), &lInit);
         KMS_EXCEPTION_ASSERT(3 == lRet, RESULT_INVALID_FORMAT, "Invalid timer line (NOT TESTED)", "");
 
-        auto lCounter = new Counter(lName, lIndex, lInit);
+        auto lCounter = NewObject<Counter>(lName, lIndex, lInit);
 
         ObjectList::AddObject(lCounter);
     }
 
+    void CounterList::ReadSnapshotRecord(SnapshotReader* aReader, unsigned int)
+    {
+        assert(nullptr != aReader);
+
+        auto lIndex = aReader->Get_UInt  ();
+        auto lName  = aReader->Get_String();
+        auto lInit  = aReader->Get_UInt  ();
+
+        ObjectList::AddObject(NewObject<Counter>(lName, lIndex, lInit));
+    }
+
     bool CounterList::Import(const char* aName, unsigned int aInit)
     {
-        auto lObject = FindObject_ByName(aName);
-        if (nullptr == lObject)
+        auto lCounter = Find_ByName(aName);
+        if (nullptr == lCounter)
         {
             if (IsProjectLegacy())
             {
@@ -57,17 +66,20 @@ namespace TRiLOGI
 
             auto lIndex = FindFreeIndex();
 
-            auto lCounter = new Counter(aName, lIndex, aInit);
+            auto lNew = NewObject<Counter>(aName, lIndex, aInit);
 
-            ObjectList::AddObject(lCounter);
+            ObjectList::AddObject(lNew);
             return true;
         }
 
         // NOT TESTED
-        auto lCounter = dynamic_cast<Counter*>(lObject);
-        assert(nullptr != lCounter);
+        auto lResult = lCounter->SetInit(aInit);
+        if (lResult)
+        {
+            SetDirty();
+        }
 
-        return lCounter->SetInit(aInit);
+        return lResult;
     }
 
 }
@@ -17,13 +17,15 @@
 
 using namespace KMS;
 
+KMS_RESULT_STATIC(RESULT_ALREADY_EXIST);
+
 namespace TRiLOGI
 {
 
     // Public
     // //////////////////////////////////////////////////////////////////////
 
-    DefineList::DefineList() : ObjectList("define", 2000) {}
+    DefineList::DefineList() : TypedList("define", 2000, SymbolKind::QTY) {}
 
     void DefineList::ClearList()
     {
@@ -33,13 +35,57 @@ namespace TRiLOGI
         ObjectList::ClearList();
     }
 
+    unsigned int DefineList::Clean()
+    {
+        for (auto lObj : mObjects_ByIndex)
+        {
+            if ((nullptr != lObj) && lObj->TestFlag(Object::FLAG_NOT_USED))
+            {
+                auto lWord = static_cast<const Word*>(ObjectList::FindObject_ByName(lObj->GetName(), SymbolKind::WORD));
+                if (lObj == lWord)
+                {
+                    mWords.RemoveWord(lWord);
+                }
+            }
+        }
+
+        return ObjectList::Clean();
+    }
+
+    void DefineList::DisplayStats() const
+    {
+        ObjectList::DisplayStats();
+
+        ::Console::Stats(mConstants.GetCount(), "constants");
+        ::Console::Stats(mWords    .GetCount(), "words");
+    }
+
+    Object* DefineList::FindObject_ByName(const char* aName)
+    {
+        auto lResult = ObjectList::FindObject_ByName(aName, SymbolKind::CONSTANT);
+        if (nullptr == lResult)
+        {
+            lResult = ObjectList::FindObject_ByName(aName, SymbolKind::WORD);
+        }
+
+        return lResult;
+    }
+
     bool DefineList::ImportConstant(const char* aName, const char* aValue)
     {
         assert(nullptr != aName);
 
-        auto lObject = FindObject_ByName(aName);
-        if (nullptr == lObject)
+        auto lConstant = static_cast<Constant*>(ObjectList::FindObject_ByName(aName, SymbolKind::CONSTANT));
+        if (nullptr == lConstant)
         {
+            if (nullptr != ObjectList::FindObject_ByName(aName, SymbolKind::WORD))
+            {
+                ::Console::Error_Begin()
+                    << "The name " << aName << " is already used for a word (NOT TESTED)";
+                ::Console::Error_End();
+                return false;
+            }
+
             if (IsProjectLegacy())
             {
                 ::Console::Change("New constant", aName);
@@ -47,56 +93,47 @@ namespace TRiLOGI
 
             auto lIndex = FindFreeIndex();
 
-            auto lConstant = new Constant(aName, lIndex, aValue, "");
-
-            mConstants.AddConstant(lConstant);
-
-            ObjectList::AddObject(lConstant);
+            AddDefine(NewObject<Constant>(aName, lIndex, aValue, ""));
 
             return true;
         }
 
-        auto lConstant = dynamic_cast<Constant*>(lObject);
-        if (nullptr == lConstant)
+        auto lResult = lConstant->SetValue(aValue);
+        if (lResult)
         {
-            ::Console::Error_Begin()
-                << "The name " << aName << " is already used for a word (NOT TESTED)";
-            ::Console::Error_End();
-            return false;
+            SetDirty();
         }
 
-        return lConstant->SetValue(aValue);
+        return lResult;
     }
 
     bool DefineList::ImportWord(const char* aName)
     {
         assert(nullptr != aName);
 
-        auto lObject = FindObject_ByName(aName);
-        if (nullptr == lObject)
+        if (nullptr == ObjectList::FindObject_ByName(aName, SymbolKind::WORD))
         {
+            if (nullptr != ObjectList::FindObject_ByName(aName, SymbolKind::CONSTANT))
+            {
+                ::Console::Error_Begin()
+                    << "The name " << aName << " is already used for a constant (NOT TESTED)";
+                ::Console::Error_End();
+                return false;
+            }
+
             if (IsProjectLegacy())
             {
                 ::Console::Change("New word", aName);
             }
 
-            auto lIndex = FindFreeIndex();
+            auto lIndex  = FindFreeIndex();
+            auto lOffset = mWords.ReserveOffsets(1);
 
-            lObject = mWords.AddWord(aName, lIndex, "");
-
-            ObjectList::AddObject(lObject);
+            AddDefine(NewObject<Word>(aName, lIndex, lOffset, ""));
 
             return true;
         }
 
-        auto lWord = dynamic_cast<Word*>(lObject);
-        if (nullptr == lWord)
-        {
-            ::Console::Error_Begin()
-                << "The name " << aName << " is already used for a constant (NOT TESTED)";
-            ::Console::Error_End();
-        }
-
         return false;
     }
 
@@ -104,11 +141,18 @@ namespace TRiLOGI
     {
         assert(nullptr != aName);
 
-        auto lObject = FindObject_ByName(aName);
-        if (nullptr == lObject)
+        auto lWord = static_cast<Word*>(ObjectList::FindObject_ByName(aName, SymbolKind::WORD));
+        if (nullptr == lWord)
         {
-            auto lWord = mWords.Find_ByOffset(aOffset);
-            if (nullptr != lWord)
+            if (nullptr != ObjectList::FindObject_ByName(aName, SymbolKind::CONSTANT))
+            {
+                ::Console::Error_Begin()
+                    << "The name " << aName << " is already used for a constant (NOT TESTED)";
+                ::Console::Error_End();
+                return false;
+            }
+
+            if (nullptr != mWords.Find_ByOffset(aOffset))
             {
                 ::Console::Error_Begin()
                     << "The offset " << aOffset << " is already used";
@@ -123,23 +167,12 @@ namespace TRiLOGI
 
             auto lIndex = FindFreeIndex();
 
-            auto lNewWord = new Word(aName, lIndex, aOffset, "");
-
-            mWords.AddWord(lNewWord);
-
-            ObjectList::AddObject(lNewWord);
+            AddDefine(NewObject<Word>(aName, lIndex, aOffset, ""));
 
             return true;
         }
 
-        auto lWord = dynamic_cast<Word*>(lObject);
-        if (nullptr == lWord)
-        {
-            ::Console::Error_Begin()
-                << "The name " << aName << " is already used for a constant (NOT TESTED)";
-            ::Console::Error_End();
-        }
-        else if (lWord->GetOffset() != aOffset)
+        if (lWord->GetOffset() != aOffset)
         {
             ::Console::Error_Begin()
                 << "The name " << aName << " is already uses witch another offset (NOT TESTED)";
@@ -149,19 +182,25 @@ namespace TRiLOGI
         return false;
     }
 
-    unsigned int DefineList::Parse(Text::File_UTF16* aFile_PC6, unsigned int aLineNo)
+    void DefineList::Parse(const File_PC6& aFile_PC6, unsigned int aFirst, unsigned int aEnd)
     {
-        auto lResult = ObjectList::Parse(aFile_PC6, aLineNo, 0);
+        TypedList::Parse(aFile_PC6, aFirst, aEnd, 0);
+    }
 
-        ::Console::Stats(mConstants.GetCount(), "constants");
-        ::Console::Stats(mWords    .GetCount(), "words");
+    bool DefineList::RelocateWords(const std::vector<unsigned int>& aOffsets, WordRelocation* aRelocation)
+    {
+        auto lResult = mWords.Relocate(aOffsets, aRelocation);
+        if (lResult)
+        {
+            SetDirty();
+        }
 
         return lResult;
     }
 
-    void DefineList::Verify(const Text::File_UTF16& aFile_PC6, const AddressList* aPublicAddresses)
+    void DefineList::Verify(const UsageCounter& aUsage, const AddressList* aPublicAddresses)
     {
-        ObjectList::Verify(aFile_PC6, aPublicAddresses);
+        ObjectList::Verify(aUsage, aPublicAddresses);
 
         mConstants.Verify();
     }
@@ -178,9 +217,7 @@ namespace TRiLOGI
     // Protected
     // //////////////////////////////////////////////////////////////////////
 
-    // ===== ObjectList =====================================================
-
-    void DefineList::AddObject(const wchar_t* aLine, unsigned int)
+    void DefineList::ParseLine(const wchar_t* aLine, unsigned int)
     {
         assert(nullptr != aLine);
 
@@ -191,7 +228,6 @@ namespace TRiLOGI
         KMS_EXCEPTION_ASSERT(2 == lRet, RESULT_INVALID_FORMAT, "Invalid define line", lRet);
 
         char         lComment[NAME_LENGTH];
-        Object     * lDefine;
         char         lName[NAME_LENGTH];
         unsigned int lOffset;
         char         lValue[NAME_LENGTH];
@@ -201,26 +237,87 @@ namespace TRiLOGI
 
         if (2 <= sscanf_s(lText, "%[^,],DM[%u],%[^\n\r\t]", &lName SizeInfo(lName), &lOffset, lComment SizeInfo(lComment)))
         {
-            auto lWord = new Word(lName, lIndex, lOffset, lComment);
-
-            mWords.AddWord(lWord);
-
-            lDefine = lWord;
+            AddDefine(NewObject<Word>(lName, lIndex, lOffset, lComment));
         }
         else if (1 <= sscanf_s(lText, "%[^,],%[^,],%[^\n\r\t]", &lName SizeInfo(lName), lValue SizeInfo(lValue), lComment SizeInfo(lComment)))
         {
-            auto lConstant = new Constant(lName, lIndex, lValue, lComment);
-
-            mConstants.AddConstant(lConstant);
-
-            lDefine = lConstant;
+            AddDefine(NewObject<Constant>(lName, lIndex, lValue, lComment));
         }
         else
         {
             KMS_EXCEPTION(RESULT_INVALID_FORMAT, "Invalid define line (NOT TESTED)", "");
         }
+    }
+
+    void DefineList::ReadSnapshotRecord(SnapshotReader* aReader, unsigned int)
+    {
+        assert(nullptr != aReader);
+
+        auto lKind  = static_cast<SymbolKind>(aReader->Get_UInt());
+        auto lIndex = aReader->Get_UInt  ();
+        auto lName  = aReader->Get_String();
+
+        switch (lKind)
+        {
+        case SymbolKind::CONSTANT:
+            {
+                auto lValue   = aReader->Get_String();
+                auto lComment = aReader->Get_String();
+
+                AddDefine(NewObject<Constant>(lName, lIndex, lValue, lComment));
+            }
+            break;
+
+        case SymbolKind::WORD:
+            {
+                auto lOffset  = aReader->Get_UInt  ();
+                auto lComment = aReader->Get_String();
+
+                AddDefine(NewObject<Word>(lName, lIndex, lOffset, lComment));
+            }
+            break;
+
+        default: KMS_EXCEPTION(RESULT_INVALID_FORMAT, "Invalid define in the snapshot", static_cast<unsigned int>(lKind));
+        }
+    }
+
+    // Private
+    // //////////////////////////////////////////////////////////////////////
+
+    void DefineList::AddDefine(Constant* aConstant)
+    {
+        assert(nullptr != aConstant);
+
+        VerifyName(aConstant, SymbolKind::WORD);
 
-        ObjectList::AddObject(lDefine);
+        mConstants.AddConstant(aConstant);
+
+        ObjectList::AddObject(aConstant, SymbolKind::CONSTANT);
+    }
+
+    void DefineList::AddDefine(Word* aWord)
+    {
+        assert(nullptr != aWord);
+
+        VerifyName(aWord, SymbolKind::CONSTANT);
+
+        mWords.AddWord(aWord);
+
+        ObjectList::AddObject(aWord, SymbolKind::WORD);
+    }
+
+    // A constant and a word may not have the same name. The symbol table
+    // only detects the duplicates of the same kind.
+    void DefineList::VerifyName(const Object* aObject, SymbolKind aOther)
+    {
+        assert(nullptr != aObject);
+
+        if (nullptr != ObjectList::FindObject_ByName(aObject->GetName(), aOther))
+        {
+            char lMsg[64 + NAME_LENGTH];
+            sprintf_s(lMsg, "A define named \"%s\" already exist (NOT TESTED)", aObject->GetName());
+            KMS_EXCEPTION(RESULT_ALREADY_EXIST, lMsg, "");
+        }
     }
 
 }
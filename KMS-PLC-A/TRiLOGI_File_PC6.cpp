@@ -0,0 +1,334 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI_File_PC6.cpp
+
+#include "Component.h"
+
+// ===== Import/Includes ====================================================
+#include <KMS/File/Binary.h>
+
+// ===== Local ==============================================================
+#include "../Common/TRiLOGI/File_PC6.h"
+
+#include "Utilities.h"
+
+using namespace KMS;
+
+KMS_RESULT_STATIC(RESULT_CORRUPTED_PC6_FILE);
+
+namespace TRiLOGI
+{
+
+    // Public
+    // //////////////////////////////////////////////////////////////////////
+
+    File_PC6::File_PC6() : mArena(0), mFile_Hash(0), mFile_Size_byte(0) {}
+
+    void File_PC6::Clear()
+    {
+        mLines_Previous.swap(mLines);
+
+        mLines.clear();
+
+        mArena = 1 - mArena;
+
+        GetArena()->Reset();
+    }
+
+    const wchar_t* File_PC6::GetLine(unsigned int aLineNo) const
+    {
+        assert(mLines.size() > aLineNo);
+
+        return mLines[aLineNo];
+    }
+
+    unsigned int File_PC6::GetLineCount() const { return static_cast<unsigned int>(mLines.size()); }
+
+    uint64_t     File_PC6::GetHash     () const { return mFile_Hash; }
+    unsigned int File_PC6::GetSize_byte() const { return mFile_Size_byte; }
+
+    void File_PC6::AddLine(const wchar_t* aLine)
+    {
+        assert(nullptr != aLine);
+
+        mLines.push_back(GetArena()->Copy(aLine));
+    }
+
+    void File_PC6::AddLine_Keep(const wchar_t* aLine)
+    {
+        assert(nullptr != aLine);
+
+        auto lBegin = mData.data();
+        auto lEnd   = lBegin + mData.size();
+
+        mLines.push_back(((lBegin <= aLine) && (lEnd > aLine)) ? aLine : GetArena()->Copy(aLine));
+    }
+
+    void File_PC6::AddLine_View(const wchar_t* aLine)
+    {
+        assert(nullptr != aLine);
+
+        mLines.push_back(aLine);
+    }
+
+    wchar_t* File_PC6::AddLine_Begin(unsigned int aMaxLength)
+    {
+        assert(0 < aMaxLength);
+
+        auto lResult = static_cast<wchar_t*>(GetArena()->Reserve(aMaxLength * sizeof(wchar_t), alignof(wchar_t)));
+
+        mLines.push_back(lResult);
+
+        return lResult;
+    }
+
+    void File_PC6::AddLine_End(unsigned int aLength)
+    {
+        assert(0 < aLength);
+
+        GetArena()->Commit(aLength * sizeof(wchar_t));
+    }
+
+    // A line copied by the previous build is in the other arena. It is
+    // copied again, so the next Clear can reset this arena.
+    void File_PC6::AddLines_Previous(unsigned int aFirst, unsigned int aEnd)
+    {
+        assert(aFirst <= aEnd);
+        assert(mLines_Previous.size() >= aEnd);
+
+        for (auto lLineNo = aFirst; lLineNo < aEnd; lLineNo++)
+        {
+            AddLine_Keep(mLines_Previous[lLineNo]);
+        }
+    }
+
+    void File_PC6::Compact()
+    {
+        auto lBegin = mData.data();
+        auto lEnd   = lBegin + mData.size();
+
+        for (auto& lLine : mLines)
+        {
+            assert(nullptr != lLine);
+
+            if ((lBegin <= lLine) && (lEnd > lLine))
+            {
+                lLine = GetArena()->Copy(lLine);
+            }
+        }
+
+        mLines_Previous.clear();
+
+        // clear would keep the memory
+        std::vector<wchar_t>().swap(mData);
+    }
+
+    // The lines keep their carriage return, like the lines Text::File_UTF16
+    // reads using FLAG_DO_NOT_REMOVE_CR. Each line feed becomes the null
+    // character terminating the line.
+    void File_PC6::Read(const File::Folder& aFolder, const char* aFileName)
+    {
+        assert(nullptr != aFileName);
+
+        Clear();
+
+        File::Binary lFile(aFolder, aFileName);
+
+        auto lIn        = reinterpret_cast<const uint8_t*>(lFile.Map());
+        auto lSize_byte = lFile.GetMappedSize();
+
+        KMS_EXCEPTION_ASSERT((2 <= lSize_byte) && (0 == (lSize_byte % 2)), RESULT_CORRUPTED_PC6_FILE, "Invalid PC6 file size (NOT TESTED)", lSize_byte);
+        KMS_EXCEPTION_ASSERT((0xfe == lIn[0]) && (0xff == lIn[1]), RESULT_CORRUPTED_PC6_FILE, "The PC6 file is not UTF-16 big endian (NOT TESTED)", aFileName);
+
+        mFile_Hash      = Utl_Hash(lIn, lSize_byte);
+        mFile_Size_byte = lSize_byte;
+
+        auto lCount = (lSize_byte - 2) / 2;
+
+        std::vector<wchar_t> lData(lCount + 1, L'\0');
+
+        auto lBegin = true;
+
+        for (unsigned int i = 0; i < lCount; i++)
+        {
+            auto lC = static_cast<wchar_t>((lIn[2 + 2 * i] << 8) | lIn[3 + 2 * i]);
+
+            if (lBegin)
+            {
+                mLines.push_back(&lData[i]);
+                lBegin = false;
+            }
+
+            if (L'\n' == lC)
+            {
+                lBegin = true;
+            }
+            else
+            {
+                lData[i] = lC;
+            }
+        }
+
+        // The pointers stay valid, the vectors exchange their buffers
+        mData.swap(lData);
+
+        // The previous lines refer to the buffer just released
+        mLines_Previous.clear();
+    }
+
+    uint64_t File_PC6::ReadHash(const File::Folder& aFolder, const char* aFileName, unsigned int* aSize_byte)
+    {
+        assert(nullptr != aFileName);
+        assert(nullptr != aSize_byte);
+
+        File::Binary lFile(aFolder, aFileName);
+
+        auto lIn = lFile.Map();
+
+        *aSize_byte = lFile.GetMappedSize();
+
+        return Utl_Hash(lIn, *aSize_byte);
+    }
+
+    // The snapshot contains the decoded buffer and the offset of each line,
+    // so neither the characters nor the line feeds are processed again.
+    void File_PC6::ReadSnapshot(SnapshotReader* aReader, uint64_t aHash, unsigned int aSize_byte)
+    {
+        assert(nullptr != aReader);
+
+        Clear();
+
+        auto lCount = aReader->Get_UInt();
+
+        // The file contains a UTF-16 code unit for each character
+        KMS_EXCEPTION_ASSERT((0 < lCount) && (aSize_byte / 2 >= lCount), RESULT_INVALID_FORMAT, "Invalid snapshot", lCount);
+
+        std::vector<wchar_t> lData(lCount);
+
+        memcpy(lData.data(), aReader->Get_Data(lCount * sizeof(wchar_t)), lCount * sizeof(wchar_t));
+
+        // Each line ends before the end of the buffer
+        KMS_EXCEPTION_ASSERT(L'\0' == lData.back(), RESULT_INVALID_FORMAT, "Invalid snapshot", lCount);
+
+        auto lLineCount = aReader->Get_UInt();
+
+        KMS_EXCEPTION_ASSERT(lCount >= lLineCount, RESULT_INVALID_FORMAT, "Invalid snapshot", lLineCount);
+
+        mLines.reserve(lLineCount);
+
+        for (unsigned int i = 0; i < lLineCount; i++)
+        {
+            auto lOffset = aReader->Get_UInt();
+
+            KMS_EXCEPTION_ASSERT(lCount > lOffset, RESULT_INVALID_FORMAT, "Invalid snapshot", lOffset);
+
+            mLines.push_back(lData.data() + lOffset);
+        }
+
+        mFile_Hash      = aHash;
+        mFile_Size_byte = aSize_byte;
+
+        mData.swap(lData);
+
+        mLines_Previous.clear();
+    }
+
+    bool File_PC6::Write(const File::Folder& aFolder, const char* aFileName, const char* aBackup)
+    {
+        assert(nullptr != aFileName);
+
+        std::vector<uint8_t> lOut;
+
+        Encode(&lOut);
+
+        auto lHash      = Utl_Hash(lOut.data(), static_cast<unsigned int>(lOut.size()));
+        auto lSize_byte = static_cast<unsigned int>(lOut.size());
+
+        if ((mFile_Hash == lHash) && (mFile_Size_byte == lSize_byte) && aFolder.DoesFileExist(aFileName))
+        {
+            return false;
+        }
+
+        Utl_ReplaceFile(aFolder, aFileName, lOut, aBackup);
+
+        mFile_Hash      = lHash;
+        mFile_Size_byte = lSize_byte;
+
+        return true;
+    }
+
+    // The lines keep their carriage return, so the export uses the end of
+    // line of Windows. The characters outside of Latin-1, which no byte
+    // represents, become '?'.
+    bool File_PC6::Write_ASCII(const File::Folder& aFolder, const char* aFileName) const
+    {
+        std::vector<uint8_t> lOut;
+
+        for (auto lLine : mLines)
+        {
+            assert(nullptr != lLine);
+
+            for (auto lC = lLine; L'\0' != *lC; lC++)
+            {
+                lOut.push_back((0x100 > *lC) ? static_cast<uint8_t>(*lC) : '?');
+            }
+
+            lOut.push_back('\n');
+        }
+
+        return Utl_WriteIfChanged(aFolder, aFileName, lOut);
+    }
+
+    void File_PC6::WriteSnapshot(SnapshotWriter* aWriter) const
+    {
+        assert(nullptr != aWriter);
+
+        auto lBegin = mData.data();
+        auto lCount = static_cast<unsigned int>(mData.size());
+
+        aWriter->Add_UInt(lCount);
+        aWriter->Add_Data(lBegin, lCount * sizeof(wchar_t));
+
+        aWriter->Add_UInt(static_cast<unsigned int>(mLines.size()));
+
+        for (auto lLine : mLines)
+        {
+            assert((lBegin <= lLine) && (lBegin + lCount > lLine));
+
+            aWriter->Add_UInt(static_cast<unsigned int>(lLine - lBegin));
+        }
+    }
+
+    // Private
+    // //////////////////////////////////////////////////////////////////////
+
+    void File_PC6::Encode(std::vector<uint8_t>* aOut) const
+    {
+        assert(nullptr != aOut);
+
+        aOut->clear();
+
+        aOut->push_back(0xfe);
+        aOut->push_back(0xff);
+
+        for (auto lLine : mLines)
+        {
+            assert(nullptr != lLine);
+
+            for (auto lC = lLine; L'\0' != *lC; lC++)
+            {
+                aOut->push_back(static_cast<uint8_t>(*lC >> 8));
+                aOut->push_back(static_cast<uint8_t>(*lC));
+            }
+
+            aOut->push_back(0x00);
+            aOut->push_back('\n');
+        }
+    }
+
+    Arena* File_PC6::GetArena() { return mArenas + mArena; }
+
+}
@@ -9,13 +9,16 @@
 
 #include "Component.h"
 
-// ===== C++ ================================================================
-#include <codecvt>
-
 // ===== Local ==============================================================
+#include "../Common/TRiLOGI/File_PC6.h"
+#include "../Common/TRiLOGI/RecordWriter.h"
+#include "../Common/Snapshot.h"
+
 #include "TRiLOGI/PC6.h"
 
 #include "TRiLOGI/Function.h"
+#include "TRiLOGI/Optimizer.h"
+#include "TRiLOGI/WordRelocation.h"
 
 #include "Utilities.h"
 
@@ -37,35 +40,48 @@ namespace TRiLOGI
         , mLength(0)
     {}
 
-    void Function::AddCodeToFile(Text::File_UTF16* aFile_PC6)
+    void Function::AddCodeToFile(File_PC6* aFile_PC6)
     {
         assert(nullptr != aFile_PC6);
 
-        aFile_PC6->AddLine(PC6_FUNCTION_MARK);
-
-        wchar_t lLine[LINE_LENGTH];
-
-        swprintf_s(lLine, L"Fn#%u,%u\r", GetIndex(), mLength);
+        aFile_PC6->AddLine_View(PC6_FUNCTION_MARK);
 
-        aFile_PC6->AddLine(lLine);
+        RecordWriter lWriter(aFile_PC6);
 
-        std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> lConverter;
+        lWriter.Begin();
+        {
+            lWriter.Add(L"Fn#");
+            lWriter.Add_UInt(GetIndex());
+            lWriter.Add(L',');
+            lWriter.Add_UInt(mLength);
+            lWriter.Add(L'\r');
+        }
+        lWriter.End();
 
         for (auto& lLine : mLines)
         {
             Utl_RemoveSpecialChar(&lLine);
 
-            std::wstring lLineW(lConverter.from_bytes(lLine.c_str()));
-
-            aFile_PC6->AddLine(lLineW.c_str());
+            lWriter.Begin();
+            {
+                lWriter.Add_UTF8(lLine.c_str());
+            }
+            lWriter.End();
         }
     }
 
-    void Function::Parse(Text::File_ASCII* aFile, Text::File_ASCII::Internal::iterator* aIt)
+    void Function::Optimize(Optimizer* aOptimizer)
     {
-        assert(nullptr != aIt);
+        assert(nullptr != aOptimizer);
+
+        aOptimizer->Optimize(GetName(), &mLines);
 
-        (*aIt)++;
+        mLength = GetLength();
+    }
+
+    void Function::Parse(Parser* aParser)
+    {
+        assert(nullptr != aParser);
 
         char lLine[LINE_LENGTH];
 
@@ -75,13 +91,47 @@ namespace TRiLOGI
 
         AddLine("// Imported using KMS-PLC");
 
-        ::Function::Parse(aFile, aIt, "FUNCTION END");
+        ::Function::Parse(aParser, "FUNCTION END");
 
         mLength = GetLength();
     }
 
+    bool Function::RelocateWords(WordRelocation* aRelocation)
+    {
+        assert(nullptr != aRelocation);
+
+        auto lResult = false;
+
+        for (auto& lLine : mLines)
+        {
+            lResult |= aRelocation->Rewrite(&lLine);
+        }
+
+        if (lResult)
+        {
+            mLength = GetLength();
+        }
+
+        return lResult;
+    }
+
     // ===== Object =========================================================
 
     Function::~Function() {}
 
+    void Function::WriteSnapshot(SnapshotWriter* aWriter) const
+    {
+        assert(nullptr != aWriter);
+
+        Object::WriteSnapshot(aWriter);
+
+        aWriter->Add_UInt(mLength);
+        aWriter->Add_UInt(GetLineCount());
+
+        for (const auto& lLine : mLines)
+        {
+            aWriter->Add_String(lLine.c_str());
+        }
+    }
+
 }
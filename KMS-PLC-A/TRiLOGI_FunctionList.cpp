@@ -9,14 +9,13 @@
 
 #include "Component.h"
 
-// ===== C++ ================================================================
-#include <codecvt>
-
 // ===== Local ==============================================================
 #include "../Common/TRiLOGI/FunctionList.h"
 
 #include "TRiLOGI/PC6.h"
+#include "TRiLOGI/Constant.h"
 #include "TRiLOGI/Function.h"
+#include "TRiLOGI/UsageCounter.h"
 
 using namespace KMS;
 
@@ -24,36 +23,112 @@ KMS_RESULT_STATIC(RESULT_CORRUPTED_PC6_FILE);
 KMS_RESULT_STATIC(RESULT_ALREADY_EXIST);
 KMS_RESULT_STATIC(RESULT_INVALID_FUNCTION_FORMAT);
 
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+// Return  true when nothing but a separator or a comment follows the
+//         argument
+static bool IsArgEnd(const char* aIn);
+
+static bool IsNameChar (unsigned int aC);
+static bool IsNameFirst(unsigned int aC);
+
+// Return  0 when aIn does not start with a number
+static unsigned int ToNumber(const char* aIn, const char** aEnd);
+
 namespace TRiLOGI
 {
 
     // Public
     // //////////////////////////////////////////////////////////////////////
 
-    FunctionList::FunctionList() : ObjectList("function", 256) {}
+    FunctionList::FunctionList() : TypedList("function", 256, SymbolKind::FUNCTION) {}
 
-    Function* FunctionList::Find_ByIndex(unsigned int aIndex)
+    // The symbol table rejects a name designating two functions, so each
+    // named function has a distinct name.
+    void FunctionList::DisplayStats() const
     {
-        return dynamic_cast<Function*>(FindObject_ByIndex(aIndex));
+        unsigned int lNames = 0;
+
+        for (auto lObject : mObjects_ByIndex)
+        {
+            if ((nullptr != lObject) && ('\0' != lObject->GetName()[0]))
+            {
+                lNames++;
+            }
+        }
+
+        ::Console::Stats(GetCount(), "functions");
+        ::Console::Stats(lNames    , "function names");
     }
 
-    Function* FunctionList::Find_ByName(const char* aName)
+    void FunctionList::AddCodeToFile(File_PC6* aFile_PC6)
     {
-        return dynamic_cast<Function*>(FindObject_ByName(aName));
+        for (auto lObject : mObjects_ByIndex)
+        {
+            if (nullptr != lObject)
+            {
+                static_cast<Function*>(lObject)->AddCodeToFile(aFile_PC6);
+            }
+        }
     }
 
-    void FunctionList::AddCodeToFile(Text::File_UTF16* aFile_PC6)
+    // The value of the constant must be a number, without expression.
+    unsigned int FunctionList::GetNumber(const char* aArg) const
     {
-        for (const auto& lEntry : mObjects_ByIndex)
+        assert(nullptr != aArg);
+
+        auto lIn = aArg;
+
+        while ((' ' == *lIn) || ('\t' == *lIn)) { lIn++; }
+
+        unsigned int lResult;
+
+        if (IsNameFirst(static_cast<unsigned char>(*lIn)))
         {
-            auto* lFunction = dynamic_cast<Function*>(lEntry.second);
-            assert(nullptr != lFunction);
+            char lName[NAME_LENGTH];
+            unsigned int lLength = 0;
+
+            while (IsNameChar(static_cast<unsigned char>(*lIn)))
+            {
+                if (sizeof(lName) - 1 <= lLength)
+                {
+                    return 0;
+                }
+
+                lName[lLength] = *lIn;
+                lLength++;
+                lIn++;
+            }
+
+            lName[lLength] = '\0';
+
+            auto lConstant = static_cast<const Constant*>(FindObject_ByName(lName, SymbolKind::CONSTANT));
+            if (nullptr == lConstant)
+            {
+                return 0;
+            }
 
-            lFunction->AddCodeToFile(aFile_PC6);
+            const char* lEnd;
+
+            lResult = ToNumber(lConstant->GetValue(), &lEnd);
+
+            while (' ' == *lEnd) { lEnd++; }
+
+            if ('\0' != *lEnd)
+            {
+                return 0;
+            }
+        }
+        else
+        {
+            lResult = ToNumber(lIn, &lIn);
         }
+
+        return IsArgEnd(lIn) ? lResult : 0;
     }
 
-    bool FunctionList::Import(const char* aName, Text::File_ASCII* aFile, Text::File_ASCII::Internal::iterator* aIt)
+    bool FunctionList::Import(const char* aName, Parser* aParser, Optimizer* aOptimizer)
     {
         unsigned int lIndex;
 
@@ -67,16 +142,15 @@ namespace TRiLOGI
             lIndex = lFunction->GetIndex();
         }
 
-        auto lNew = new Function(aName, lIndex);
+        // The function is parsed on the stack and copied into the arena only
+        // when it is new or changed.
+        Function lNew(aName, lIndex);
 
-        try
-        {
-            lNew->Parse(aFile, aIt);
-        }
-        catch (...)
+        lNew.Parse(aParser);
+
+        if (nullptr != aOptimizer)
         {
-            delete lNew;
-            throw;
+            lNew.Optimize(aOptimizer);
         }
 
         auto lResult = true;
@@ -88,19 +162,18 @@ namespace TRiLOGI
                 ::Console::Change("New function", aName);
             }
 
-            AddObject(lNew);
+            AddObject(NewFunction(lNew));
         }
         else
         {
-            if (*lNew != *lFunction)
+            if (lNew != *lFunction)
             {
                 ::Console::Change("Function changed (NOT TESTED)", aName);
 
-                Replace(lFunction, lNew);
+                Replace(lFunction, NewFunction(lNew));
             }
             else
             {
-                delete lNew;
                 lResult = false;
             }
         }
@@ -108,34 +181,30 @@ namespace TRiLOGI
         return lResult;
     }
 
-    unsigned int FunctionList::Parse_Code(Text::File_UTF16* aFile_PC6, unsigned int aLineNo)
+    void FunctionList::Parse_Code(const File_PC6& aFile_PC6, unsigned int aFirst, unsigned int aEnd)
     {
-        assert(nullptr != aFile_PC6);
-        assert(0 < aLineNo);
+        assert(0 < aFirst);
+        assert(aFirst <= aEnd);
 
-        Function   * lFunction  = nullptr;
-        auto         lLineCount = aFile_PC6->GetLineCount();
+        Function   * lFunction = nullptr;
+        unsigned int lFunction_LineNo = 0;
         unsigned int lIndex;
-        auto         lLineNo    = aLineNo;
         char         lMsg[64];
 
-        for (; lLineNo < lLineCount; lLineNo++)
+        for (auto lLineNo = aFirst; lLineNo < aEnd; lLineNo++)
         {
             unsigned int lLength;
 
-            auto lLine = aFile_PC6->GetLine(lLineNo);
+            auto lLine = aFile_PC6.GetLine(lLineNo);
             assert(nullptr != lLine);
 
-            if (0 == wcscmp(PC6_SECTION_END_CUSTFN, lLine)) { lLineNo++; break; }
-
             if ((0 == wcscmp(L"\xc8\r", lLine)) || (0 == wcscmp(L"\xc8", lLine)))
             {
                 if (nullptr != lFunction)
                 {
-                    auto lBI = mObjects_ByIndex.insert(ByIndex::value_type(lIndex, lFunction));
-                    if (!lBI.second)
+                    if (!Insert_ByIndex(lFunction, lIndex))
                     {
-                        sprintf_s(lMsg, "Line %u  A function already exist at index %u (NOT TESTED)", lLineNo, lIndex);
+                        sprintf_s(lMsg, "Line %u  A function already exist at index %u (NOT TESTED)", lFunction_LineNo, lIndex);
                         KMS_EXCEPTION(RESULT_ALREADY_EXIST, lMsg, "");
                     }
 
@@ -150,7 +219,8 @@ namespace TRiLOGI
                     KMS_EXCEPTION(RESULT_INVALID_FUNCTION_FORMAT, lMsg, "");
                 }
 
-                lFunction = new Function(lIndex, lLength);
+                lFunction        = mArena.New<Function>(lIndex, lLength);
+                lFunction_LineNo = lLineNo;
             }
             else
             {
@@ -167,31 +237,23 @@ namespace TRiLOGI
 
         if (nullptr != lFunction)
         {
-            auto lBI = mObjects_ByIndex.insert(ByIndex::value_type(lIndex, lFunction));
-            if (!lBI.second)
+            if (!Insert_ByIndex(lFunction, lIndex))
             {
-                sprintf_s(lMsg, "Line %u  A function already exist at index %u (NOT TESTED)", aLineNo, lIndex);
+                sprintf_s(lMsg, "Line %u  A function already exist at index %u (NOT TESTED)", lFunction_LineNo, lIndex);
                 KMS_EXCEPTION(RESULT_ALREADY_EXIST, lMsg, "");
             }
         }
-
-        ::Console::Stats(GetCount(), "functions");
-
-        return lLineNo;
     }
 
-    unsigned int FunctionList::Parse_Name(Text::File_UTF16* aFile_PC6, unsigned int aLineNo)
+    void FunctionList::Parse_Name(const File_PC6& aFile_PC6, unsigned int aFirst, unsigned int aEnd)
     {
-        assert(nullptr != aFile_PC6);
-        assert(0 < aLineNo);
-
-        auto lLineCount = aFile_PC6->GetLineCount();
-        auto lLineNo    = aLineNo;
+        assert(0 < aFirst);
+        assert(aFirst <= aEnd);
 
-        for (; lLineNo < lLineCount; lLineNo++)
+        for (auto lLineNo = aFirst; lLineNo < aEnd; lLineNo++)
         {
-            auto lLine = aFile_PC6->GetLine(lLineNo);
-            if (0 == wcscmp(PC6_SECTION_END_CUSTFNLABEL, lLine)) { lLineNo++; break; }
+            auto lLine = aFile_PC6.GetLine(lLineNo);
+            assert(nullptr != lLine);
 
             unsigned int lIndex;
             char         lMsg[64 + NAME_LENGTH];
@@ -204,7 +266,7 @@ namespace TRiLOGI
             case 2: break;
 
             default:
-                sprintf_s(lMsg, "Line %u  Corrupted PC6 file (NOT TESTED)", aLineNo);
+                sprintf_s(lMsg, "Line %u  Corrupted PC6 file (NOT TESTED)", lLineNo);
                 KMS_EXCEPTION(RESULT_CORRUPTED_PC6_FILE, lMsg, lRet);
             }
 
@@ -212,46 +274,70 @@ namespace TRiLOGI
             if (nullptr == lFunction)
             {
                 // NOT TESTED
-                lFunction = new Function(lIndex, 0);
+                lFunction = mArena.New<Function>(lIndex, 0U);
 
-                auto lBI = mObjects_ByIndex.insert(ByIndex::value_type(lIndex, lFunction));
-                if (!lBI.second)
+                if (!Insert_ByIndex(lFunction, lIndex))
                 {
-                    sprintf_s(lMsg, "Line %u  A function already exist at index %u", aLineNo, lIndex);
+                    sprintf_s(lMsg, "Line %u  A function already exist at index %u", lLineNo, lIndex);
                     KMS_EXCEPTION(RESULT_ALREADY_EXIST, lMsg, "");
                 }
             }
 
-            lFunction->SetName(lName);
+            lFunction->SetName(mArena.Copy(lName));
 
-            auto lBI = mObjects_ByName.insert(ByName::value_type(lName, lFunction));
-            if (!lBI.second)
+            if (!Insert_ByName(lFunction, SymbolKind::FUNCTION))
             {
                 sprintf_s(lMsg, "Line %u  A function named \"%s\" already exist (NOT TESTED)", lLineNo, lName);
                 KMS_EXCEPTION(RESULT_ALREADY_EXIST, lMsg, "");
             }
         }
+    }
+
+    unsigned int FunctionList::RelocateWords(WordRelocation* aRelocation)
+    {
+        unsigned int lResult = 0;
+
+        auto lCount = GetCount();
+
+        for (unsigned int i = 0, lFound = 0; lFound < lCount; i++)
+        {
+            auto lFunction = Find_ByIndex(i);
+            if (nullptr != lFunction)
+            {
+                if (lFunction->RelocateWords(aRelocation))
+                {
+                    ::Console::Change("Relocated words", lFunction->GetName());
+
+                    lResult++;
+                }
+
+                lFound++;
+            }
+        }
 
-        ::Console::Stats(GetCount(), "function names");
+        if (0 < lResult)
+        {
+            SetDirty();
+        }
 
-        return lLineNo;
+        return lResult;
     }
 
-    void FunctionList::Verify(const Text::File_UTF16& aFile_PC6)
+    void FunctionList::Verify(const UsageCounter& aUsage)
     {
-        std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> lConverter;
-
         unsigned int lCount = 0;
 
-        for (auto& lVT : mObjects_ByIndex)
+        for (auto lFunction : mObjects_ByIndex)
         {
-            auto lFunction = lVT.second;
-            assert(nullptr != lFunction);
+            if (nullptr == lFunction)
+            {
+                continue;
+            }
 
             auto lName = lFunction->GetName();
             assert(nullptr != lName);
 
-            switch (aFile_PC6.CountOccurrence(lConverter.from_bytes(lName).c_str()))
+            switch (aUsage.GetCount(lName))
             {
             case 0: assert(false);
 
@@ -274,4 +360,108 @@ namespace TRiLOGI
         }
     }
 
+    // Protected
+    // //////////////////////////////////////////////////////////////////////
+
+    void FunctionList::ReadSnapshotRecord(SnapshotReader* aReader, unsigned int)
+    {
+        assert(nullptr != aReader);
+
+        auto lIndex  = aReader->Get_UInt  ();
+        auto lName   = aReader->Get_String();
+        auto lLength = aReader->Get_UInt  ();
+        auto lCount  = aReader->Get_UInt  ();
+
+        auto lFunction = mArena.New<Function>(lIndex, lLength);
+
+        for (unsigned int i = 0; i < lCount; i++)
+        {
+            lFunction->AddLine(aReader->Get_String());
+        }
+
+        // Like Parse_Code, a function the name section does not name has no
+        // symbol.
+        if ('\0' == lName[0])
+        {
+            KMS_EXCEPTION_ASSERT(Insert_ByIndex(lFunction, lIndex), RESULT_ALREADY_EXIST, "A function already exist at this index (NOT TESTED)", lIndex);
+        }
+        else
+        {
+            lFunction->SetName(mArena.Copy(lName));
+
+            AddObject(lFunction);
+        }
+    }
+
+    // Private
+    // //////////////////////////////////////////////////////////////////////
+
+    Function* FunctionList::NewFunction(const Function& aFunction)
+    {
+        auto lResult = mArena.New<Function>(aFunction);
+
+        lResult->SetName(mArena.Copy(aFunction.GetName()));
+
+        return lResult;
+    }
+
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+bool IsArgEnd(const char* aIn)
+{
+    assert(nullptr != aIn);
+
+    auto lIn = aIn;
+
+    while ((' ' == *lIn) || ('\t' == *lIn))
+    {
+        lIn++;
+    }
+
+    switch (*lIn)
+    {
+    case '\0':
+    case '\r':
+    case '\'':
+    case ',' :
+    case ':' :
+        return true;
+
+    case '/': return '/' == lIn[1];
+    }
+
+    // A keyword, ELSE or REM for example
+    return IsNameFirst(static_cast<unsigned char>(*lIn));
+}
+
+bool IsNameChar(unsigned int aC)
+{
+    return IsNameFirst(aC) || (('0' <= aC) && ('9' >= aC));
+}
+
+bool IsNameFirst(unsigned int aC)
+{
+    return (('A' <= aC) && ('Z' >= aC)) || (('a' <= aC) && ('z' >= aC)) || ('_' == aC);
+}
+
+unsigned int ToNumber(const char* aIn, const char** aEnd)
+{
+    assert(nullptr != aIn);
+    assert(nullptr != aEnd);
+
+    auto lIn = aIn;
+    unsigned int lResult = 0;
+
+    while (('0' <= *lIn) && ('9' >= *lIn) && (0xffff >= lResult))
+    {
+        lResult = lResult * 10 + (*lIn - '0');
+        lIn++;
+    }
+
+    *aEnd = lIn;
+
+    return lResult;
 }
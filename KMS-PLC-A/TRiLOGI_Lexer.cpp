@@ -0,0 +1,239 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI_Lexer.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "TRiLOGI/Lexer.h"
+#include "TRiLOGI/PC6_in0.h"
+
+using namespace KMS;
+
+// Data type and constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define ARG_QTY (2)
+
+// Argument types
+//  N  Name, only letters, digits and _
+//  S  String
+//  U  Unsigned integer
+// A lower case letter indicates an optional argument.
+typedef struct
+{
+    const char     * mName;
+    TRiLOGI::Keyword mKeyword;
+    const char     * mArgs;
+}
+KeywordInfo;
+
+// The table is in the order of the Keyword enum
+static const KeywordInfo KEYWORDS[] =
+{
+    { PC6_IN0_ADDRESS  , TRiLOGI::Keyword::ADDRESS  , "Nn" },
+    { PC6_IN0_ADDRESSES, TRiLOGI::Keyword::ADDRESSES, "S"  },
+    { PC6_IN0_CONSTANT , TRiLOGI::Keyword::CONSTANT , "NS" },
+    { PC6_IN0_COUNTER  , TRiLOGI::Keyword::COUNTER  , "NU" },
+    { PC6_IN0_FUNCTION , TRiLOGI::Keyword::FUNCTION , "N"  },
+    { PC6_IN0_INPUT    , TRiLOGI::Keyword::INPUT    , "NU" },
+    { PC6_IN0_OUTPUT   , TRiLOGI::Keyword::OUTPUT   , "NU" },
+    { PC6_IN0_RELAY    , TRiLOGI::Keyword::RELAY    , "Nu" },
+    { PC6_IN0_TIMER    , TRiLOGI::Keyword::TIMER    , "NU" },
+    { PC6_IN0_WORD     , TRiLOGI::Keyword::WORD     , "Nu" },
+};
+
+#define KEYWORD_QTY (sizeof(KEYWORDS) / sizeof(KEYWORDS[0]))
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static bool IsName(const char* aToken);
+static bool IsUInt(const char* aToken);
+
+namespace TRiLOGI
+{
+
+    // Public
+    // //////////////////////////////////////////////////////////////////////
+
+    Lexer::Lexer(const char* aFileName) : mParser(aFileName), mArgCount(0), mKeyword(Keyword::INVALID)
+    {
+        memset(&mArgs     , 0, sizeof(mArgs));
+        memset(&mArgs_UInt, 0, sizeof(mArgs_UInt));
+
+        mLine  [0] = '\0';
+        mTokens[0] = '\0';
+    }
+
+    // A line the table does not describe is returned with the INVALID
+    // keyword, so the caller can report it.
+    bool Lexer::GetNextStatement()
+    {
+        if (!mParser.GetNextLine(mLine, sizeof(mLine)))
+        {
+            return false;
+        }
+
+        Tokenize();
+
+        return true;
+    }
+
+    const char* Lexer::GetArg(unsigned int aIndex) const
+    {
+        assert(mArgCount > aIndex);
+
+        return mArgs[aIndex];
+    }
+
+    unsigned int Lexer::GetArg_UInt(unsigned int aIndex) const
+    {
+        assert(mArgCount > aIndex);
+
+        return mArgs_UInt[aIndex];
+    }
+
+    unsigned int Lexer::GetArgCount() const { return mArgCount; }
+
+    Keyword Lexer::GetKeyword() const { return mKeyword; }
+
+    const char* Lexer::GetLine() const { return mLine; }
+
+    unsigned int Lexer::GetLineNo() const { return mParser.GetLineNo(); }
+
+    Parser* Lexer::GetParser() { return &mParser; }
+
+    // Private
+    // //////////////////////////////////////////////////////////////////////
+
+    // Like the sscanf_s formats the table replaces, the tokens following
+    // the last argument are ignored.
+    void Lexer::Tokenize()
+    {
+        char       * lTokens[1 + ARG_QTY];
+        unsigned int lTokenCount = 0;
+
+        mArgCount = 0;
+        mKeyword  = Keyword::INVALID;
+
+        strcpy_s(mTokens, mLine);
+
+        auto lPtr = mTokens;
+
+        while ((1 + ARG_QTY) > lTokenCount)
+        {
+            while ((' ' == *lPtr) || ('\t' == *lPtr))
+            {
+                lPtr++;
+            }
+
+            if (('\0' == *lPtr) || ('#' == *lPtr))
+            {
+                break;
+            }
+
+            lTokens[lTokenCount] = lPtr;
+            lTokenCount++;
+
+            while (('\0' != *lPtr) && ('#' != *lPtr) && (' ' != *lPtr) && ('\t' != *lPtr))
+            {
+                lPtr++;
+            }
+
+            if ('#' == *lPtr)
+            {
+                *lPtr = '\0';
+                break;
+            }
+
+            if ('\0' != *lPtr)
+            {
+                *lPtr = '\0';
+                lPtr++;
+            }
+        }
+
+        assert(0 < lTokenCount);
+
+        for (unsigned int i = 0; i < KEYWORD_QTY; i++)
+        {
+            const auto& lKeyword = KEYWORDS[i];
+
+            if (0 == strcmp(lKeyword.mName, lTokens[0]))
+            {
+                assert(static_cast<unsigned int>(lKeyword.mKeyword) == i);
+
+                for (auto lType = lKeyword.mArgs; '\0' != *lType; lType++)
+                {
+                    if (lTokenCount <= 1 + mArgCount)
+                    {
+                        if (isupper(*lType))
+                        {
+                            return;
+                        }
+                        break;
+                    }
+
+                    auto lToken = lTokens[1 + mArgCount];
+
+                    switch (toupper(*lType))
+                    {
+                    case 'N': if (!IsName(lToken)) { return; } break;
+                    case 'S': break;
+
+                    case 'U':
+                        if (!IsUInt(lToken)) { return; }
+                        mArgs_UInt[mArgCount] = strtoul(lToken, nullptr, 10);
+                        break;
+
+                    default: assert(false);
+                    }
+
+                    mArgs[mArgCount] = lToken;
+                    mArgCount++;
+                }
+
+                mKeyword = lKeyword.mKeyword;
+                break;
+            }
+        }
+    }
+
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+bool IsName(const char* aToken)
+{
+    assert(nullptr != aToken);
+
+    for (auto lPtr = aToken; '\0' != *lPtr; lPtr++)
+    {
+        if ((!isalnum(static_cast<unsigned char>(*lPtr))) && ('_' != *lPtr))
+        {
+            return false;
+        }
+    }
+
+    return '\0' != aToken[0];
+}
+
+bool IsUInt(const char* aToken)
+{
+    assert(nullptr != aToken);
+
+    for (auto lPtr = aToken; '\0' != *lPtr; lPtr++)
+    {
+        if (!isdigit(static_cast<unsigned char>(*lPtr)))
+        {
+            return false;
+        }
+    }
+
+    return '\0' != aToken[0];
+}
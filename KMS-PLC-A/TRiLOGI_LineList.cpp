@@ -12,7 +12,7 @@
 // ===== Local ==============================================================
 #include "../Common/TRiLOGI/LineList.h"
 
-#include "TRiLOGI/PC6.h"
+#include "TRiLOGI/WordRelocation.h"
 
 using namespace KMS;
 
@@ -22,49 +22,82 @@ namespace TRiLOGI
     // Public
     // //////////////////////////////////////////////////////////////////////
 
-    LineList::LineList() {}
+    LineList::LineList() : mDirty(true) {}
 
-    void LineList::ClearList() { mLines.clear(); }
+    void LineList::ClearList()
+    {
+        mLines.clear();
+
+        mDirty = true;
+    }
 
     void LineList::AddLine(const wchar_t* aLine)
     {
         assert(nullptr != aLine);
 
         mLines.push_back(aLine);
+
+        mDirty = true;
     }
 
-    void LineList::AddToFile(Text::File_UTF16* aFile_PC6)
+    void LineList::AddToFile(File_PC6* aFile_PC6)
     {
         assert(nullptr != aFile_PC6);
 
-        for (const auto& lLine : mLines)
+        for (auto lLine : mLines)
         {
-            aFile_PC6->AddLine(lLine.c_str());
+            aFile_PC6->AddLine_Keep(lLine);
         }
     }
 
-    unsigned int LineList::Parse(Text::File_UTF16* aFile_PC6, unsigned int aLineNo, bool aUntilEnd)
+    const wchar_t* LineList::GetLine(unsigned int aIndex) const
     {
-        assert(nullptr != aFile_PC6);
-        assert(0 < aLineNo);
+        assert(mLines.size() > aIndex);
 
-        auto lLineCount = aFile_PC6->GetLineCount();
-        auto lLineNo    = aLineNo;
+        return mLines[aIndex];
+    }
 
-        for (; lLineNo < lLineCount; lLineNo++)
+    unsigned int LineList::GetLineCount() const { return static_cast<unsigned int>(mLines.size()); }
+
+    void LineList::Parse(const File_PC6& aFile_PC6, unsigned int aFirst, unsigned int aEnd)
+    {
+        assert(0 < aFirst);
+        assert(aFirst <= aEnd);
+
+        for (auto lLineNo = aFirst; lLineNo < aEnd; lLineNo++)
         {
-            const wchar_t* lLine = aFile_PC6->GetLine(lLineNo);
+            AddLine(aFile_PC6.GetLine(lLineNo));
+        }
+    }
 
-            if ((!aUntilEnd) && (PC6_SECTION_END_C == lLine[0]))
+    unsigned int LineList::RelocateWords(WordRelocation* aRelocation)
+    {
+        assert(nullptr != aRelocation);
+
+        unsigned int lResult = 0;
+
+        for (auto& lLine : mLines)
+        {
+            std::wstring lText(lLine);
+
+            if (aRelocation->Rewrite(&lText))
             {
-                lLineNo++;
-                break;
+                lLine = mArena.Copy(lText.c_str());
+
+                lResult++;
             }
+        }
 
-            AddLine(lLine);
+        if (0 < lResult)
+        {
+            mDirty = true;
         }
 
-        return lLineNo;
+        return lResult;
     }
 
+    bool LineList::IsDirty() const { return mDirty; }
+
+    void LineList::ClearDirty() { mDirty = false; }
+
 }
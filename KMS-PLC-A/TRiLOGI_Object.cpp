@@ -10,6 +10,9 @@
 #include "Component.h"
 
 // ===== Local ==============================================================
+#include "../Common/TRiLOGI/RecordWriter.h"
+#include "../Common/Snapshot.h"
+
 #include "TRiLOGI/Object.h"
 
 using namespace KMS;
@@ -36,13 +39,13 @@ namespace TRiLOGI
 
     unsigned int Object::GetIndex() const { return mIndex; }
 
-    const char* Object::GetName() const { return mName.c_str(); }
+    const char* Object::GetName() const { return mName; }
 
     void Object::SetName(const char* aName)
     {
         assert(nullptr != aName);
 
-        mName   = aName;
+        mName = aName;
     }
 
     bool Object::TestFlag(unsigned int aFlag) const
@@ -52,16 +55,26 @@ namespace TRiLOGI
         return 0 != (mFlags & aFlag);
     }
 
-    void Object::GetLine(wchar_t* aOut, unsigned int aOutSize_byte) const
+    void Object::WriteRecord(RecordWriter* aWriter) const
+    {
+        assert(nullptr != aWriter);
+
+        aWriter->Add_UInt(GetIndex());
+        aWriter->Add(L',');
+        aWriter->Add(GetName());
+    }
+
+    void Object::WriteSnapshot(SnapshotWriter* aWriter) const
     {
-        assert(nullptr != aOut);
+        assert(nullptr != aWriter);
 
-        swprintf_s(aOut SizeInfoV(aOutSize_byte / sizeof(wchar_t)), L"%u,%S", GetIndex(), GetName());
+        aWriter->Add_UInt  (GetIndex());
+        aWriter->Add_String(GetName());
     }
 
     // Protected
     // //////////////////////////////////////////////////////////////////////
 
-    Object::Object(unsigned int aIndex) : mFlags(0), mIndex(aIndex) {}
+    Object::Object(unsigned int aIndex) : mFlags(0), mIndex(aIndex), mName("") {}
 
 }
@@ -9,18 +9,20 @@
 
 #include "Component.h"
 
-// ===== C++ ================================================================
-#include <codecvt>
-
 // ===== Local ==============================================================
 #include "../Common/TRiLOGI/ObjectList.h"
+#include "../Common/TRiLOGI/RecordWriter.h"
+#include "../Common/Snapshot.h"
 
 #include "TRiLOGI/Object.h"
 #include "TRiLOGI/PC6.h"
+#include "TRiLOGI/Reachability.h"
+#include "TRiLOGI/UsageCounter.h"
 
 using namespace KMS;
 
 KMS_RESULT_STATIC(RESULT_ALREADY_EXIST);
+KMS_RESULT_STATIC(RESULT_INVALID_INDEX);
 KMS_RESULT_STATIC(RESULT_TOO_MANY);
 
 // Constants
@@ -34,149 +36,141 @@ namespace TRiLOGI
     // Public
     // //////////////////////////////////////////////////////////////////////
 
-    ObjectList::~ObjectList() { ClearList(); }
+    // The arena destroys the objects. The shared symbol table may already be
+    // destroyed, so the destructor does not use it.
+    ObjectList::~ObjectList() {}
 
-    void ObjectList::AddToFile(Text::File_UTF16* aFile_PC6)
+    void ObjectList::AddNames(UsageCounter* aUsage) const
     {
-        assert(nullptr != aFile_PC6);
+        assert(nullptr != aUsage);
 
-        for (const auto& lEntry : mObjects_ByIndex)
+        for (auto lObject : mObjects_ByIndex)
         {
-            assert(nullptr != lEntry.second);
+            if (nullptr != lObject)
+            {
+                aUsage->AddName(lObject->GetName());
+            }
+        }
+    }
 
-            wchar_t lLine[LINE_LENGTH];
+    void ObjectList::AddToFile(File_PC6* aFile_PC6)
+    {
+        assert(nullptr != aFile_PC6);
 
-            lEntry.second->GetLine(lLine, sizeof(lLine));
+        RecordWriter lWriter(aFile_PC6);
 
-            aFile_PC6->AddLine(lLine);
+        for (auto lObject : mObjects_ByIndex)
+        {
+            if (nullptr != lObject)
+            {
+                lWriter.Begin();
+                {
+                    lObject->WriteRecord(&lWriter);
+                }
+                lWriter.End();
+            }
         }
     }
 
     void ObjectList::ClearList()
     {
-        for (const auto& lVT : mObjects_ByIndex)
+        assert(nullptr != mSymbols);
+
+        for (auto& lObject : mObjects_ByIndex)
         {
-            assert(nullptr != lVT.second);
+            if (nullptr != lObject)
+            {
+                mSymbols->Remove(lObject);
 
-            delete lVT.second;
+                lObject = nullptr;
+            }
         }
 
-        mObjects_ByIndex.clear();
-        mObjects_ByName .clear();
+        mCount = 0;
+        mDirty = true;
+        mUsed.Clear();
+
+        mArena.Reset();
     }
 
-    unsigned int ObjectList::GetCount() const { return static_cast<unsigned int>(mObjects_ByIndex.size()); }
+    bool ObjectList::IsDirty() const { return mDirty; }
+
+    void ObjectList::ClearDirty() { mDirty = false; }
+
+    unsigned int ObjectList::GetCount() const { return mCount; }
+
+    void ObjectList::DisplayStats() const { ::Console::Stats(GetCount(), GetElementName()); }
 
     const Object* ObjectList::FindObject_ByIndex(unsigned int aIndex) const
     {
-        auto lIt = mObjects_ByIndex.find(aIndex);
-        if (mObjects_ByIndex.end() == lIt)
-        {
-            return nullptr;
-        }
-
         // NOT TESTED
-        assert(nullptr != lIt->second);
-
-        return lIt->second;
+        return (mMaxQty > aIndex) ? mObjects_ByIndex[aIndex] : nullptr;
     }
 
     Object* ObjectList::FindObject_ByIndex(unsigned int aIndex)
     {
-        auto lIt = mObjects_ByIndex.find(aIndex);
-        if (mObjects_ByIndex.end() == lIt)
-        {
-            return nullptr;
-        }
-
-        assert(nullptr != lIt->second);
-
-        return lIt->second;
+        return (mMaxQty > aIndex) ? mObjects_ByIndex[aIndex] : nullptr;
     }
 
     Object* ObjectList::FindObject_ByName(const char* aName)
     {
-        assert(nullptr != aName);
-
-        auto lIt = mObjects_ByName.find(aName);
-        if (mObjects_ByName.end() == lIt)
-        {
-            return nullptr;
-        }
-
-        assert(nullptr != lIt->second);
+        assert(nullptr != mSymbols);
+        assert(SymbolKind::QTY > mKind);
 
-        return lIt->second;
+        return mSymbols->Find(aName, mKind);
     }
 
     void ObjectList::SetProjectType(ProjectType aPT) { mProjectType = aPT; }
 
+    void ObjectList::SetSymbolTable(SymbolTable* aSymbols)
+    {
+        assert(nullptr != aSymbols);
+
+        assert(0 == mCount);
+
+        mSymbols = aSymbols;
+    }
+
     unsigned int ObjectList::Clean()
     {
         unsigned int lResult = 0;
 
-        for (auto lIt = mObjects_ByIndex.begin(); lIt != mObjects_ByIndex.end(); )
+        for (unsigned int lIndex = 0; lIndex < mMaxQty; lIndex++)
         {
-            auto lObject = lIt->second;
-            assert(nullptr != lObject);
+            auto lObject = mObjects_ByIndex[lIndex];
 
-            if (lObject->TestFlag(Object::FLAG_NOT_USED))
+            if ((nullptr != lObject) && lObject->TestFlag(Object::FLAG_NOT_USED))
             {
                 // NOT TESTED
                 lResult++;
 
-                auto lRet = mObjects_ByName.erase(lObject->GetName());
-                assert(1 == lRet);
-
-                lIt = mObjects_ByIndex.erase(lIt);
-            }
-            else
-            {
-                lIt++;
-            }
-        }
-
-        return lResult;
-    }
-
-    unsigned int ObjectList::Parse(Text::File_UTF16* aFile_PC6, unsigned int aLineNo, unsigned int aFlags)
-    {
-        assert(nullptr != aFile_PC6);
+                mSymbols->Remove(lObject);
 
-        auto lLineCount = aFile_PC6->GetLineCount();
-        auto lLineNo    = aLineNo;
+                mObjects_ByIndex[lIndex] = nullptr;
 
-        for (; lLineNo < lLineCount; lLineNo++)
-        {
-            auto lLine = aFile_PC6->GetLine(lLineNo);
-            assert(nullptr != lLine);
+                assert(0 < mCount);
 
-            if (PC6_SECTION_END_C == lLine[0])
-            {
-                lLineNo++;
-                break;
+                mCount--;
+                mDirty = true;
+                mUsed.Clear(lIndex);
             }
-
-            AddObject(lLine, aFlags);
         }
 
-        ::Console::Stats(GetCount(), GetElementName());
-
-        return lLineNo;
+        return lResult;
     }
 
-    void ObjectList::Verify(const Text::File_UTF16& aFile_PC6, const AddressList* aPublicAddresses)
+    void ObjectList::Verify(const UsageCounter& aUsage, const AddressList* aPublicAddresses)
     {
         assert(nullptr != mElementName);
 
-        std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> lConverter;
-
         unsigned int lCount = 0;
 
-        for (auto& lVT : mObjects_ByIndex)
+        for (auto lObj : mObjects_ByIndex)
         {
-            auto lObj = lVT.second;
-            assert(nullptr != lObj);
+            if (nullptr == lObj)
+            {
+                continue;
+            }
 
             auto lName = lObj->GetName();
             assert(nullptr != lName);
@@ -185,7 +179,7 @@ namespace TRiLOGI
             {
                 auto lIndex = lObj->GetIndex();
 
-                switch (aFile_PC6.CountOccurrence(lConverter.from_bytes(lName).c_str()))
+                switch (aUsage.GetCount(lName))
                 {
                 case 0: assert(false);
 
@@ -224,61 +218,106 @@ namespace TRiLOGI
         }
     }
 
+    unsigned int ObjectList::Verify_Reachability(const Reachability& aReachability, SymbolKind aKind, const AddressList* aPublicAddresses)
+    {
+        assert(nullptr != mElementName);
+
+        unsigned int lResult = 0;
+
+        for (auto lObj : mObjects_ByIndex)
+        {
+            if ((nullptr == lObj) || lObj->TestFlag(Object::FLAG_NOT_USED))
+            {
+                continue;
+            }
+
+            auto lName = lObj->GetName();
+            assert(nullptr != lName);
+
+            // A list may contain objects of more than one kind
+            if (lObj != FindObject_ByName(lName, aKind))
+            {
+                continue;
+            }
+
+            if (((nullptr == aPublicAddresses) || !aPublicAddresses->DoesContain(lName)) && !aReachability.IsReached(lObj, aKind))
+            {
+                lResult++;
+                lObj->AddFlags(Object::FLAG_NOT_USED);
+
+                ::Console::Warning_Begin()
+                    << "The " << mElementName << " named \"" << lName << "\" (" << lObj->GetIndex() << ") is not reachable";
+                ::Console::Warning_End();
+            }
+        }
+
+        return lResult;
+    }
+
+    void ObjectList::WriteSnapshot(SnapshotWriter* aWriter) const
+    {
+        assert(nullptr != aWriter);
+
+        aWriter->Add_UInt(mCount);
+
+        for (auto lObject : mObjects_ByIndex)
+        {
+            if (nullptr != lObject)
+            {
+                lObject->WriteSnapshot(aWriter);
+            }
+        }
+    }
+
     // Protected
     // //////////////////////////////////////////////////////////////////////
 
-    ObjectList::ObjectList(const char* aElementName, unsigned int aMaxQty)
-        : mElementName(aElementName)
+    ObjectList::ObjectList(const char* aElementName, unsigned int aMaxQty, SymbolKind aKind)
+        : mObjects_ByIndex(aMaxQty, nullptr)
+        , mElementName(aElementName)
+        , mCount(0)
+        , mDirty(true)
+        , mKind(aKind)
         , mMaxQty(aMaxQty)
+        , mUsed(aMaxQty)
         , mProjectType(ProjectType::LEGACY)
+        , mSymbols(&mSymbols_Private)
     {
         assert(nullptr != aElementName);
         assert(0 < aMaxQty);
+        assert(SymbolKind::QTY >= aKind);
     }
 
     const char* ObjectList::GetElementName() const { return mElementName; }
 
     bool ObjectList::IsProjectLegacy() const { return ProjectType::LEGACY == mProjectType; }
 
-    void ObjectList::AddObject(Object* aObject)
+    void ObjectList::AddObject(Object* aObject) { AddObject(aObject, mKind); }
+
+    void ObjectList::AddObject(Object* aObject, SymbolKind aKind)
     {
         assert(nullptr != aObject);
 
         char lMsg[64 + NAME_LENGTH];
 
-        auto lBI = mObjects_ByIndex.insert(ObjectList::ByIndex::value_type(aObject->GetIndex(), aObject));
-        if (!lBI.second)
+        if (!Insert_ByIndex(aObject, aObject->GetIndex()))
         {
             sprintf_s(lMsg, "An object with index %u already exist (NOT TESTED)", aObject->GetIndex());
             KMS_EXCEPTION(RESULT_ALREADY_EXIST, lMsg, "");
         }
 
-        auto lBN = mObjects_ByName.insert(ObjectList::ByName::value_type(aObject->GetName(), aObject));
-        if (!lBN.second)
+        if (!Insert_ByName(aObject, aKind))
         {
             sprintf_s(lMsg, "An object named \"%s\" already exist (NOT TESTED)", aObject->GetName());
             KMS_EXCEPTION(RESULT_ALREADY_EXIST, lMsg, "");
         }
-    }
-
-    void ObjectList::AddObject(const wchar_t* aLine, unsigned int aFlags)
-    {
-        assert(nullptr != aLine);
-
-        unsigned int lIndex;
-        char         lName[NAME_LENGTH];
-
-        auto lRet = swscanf_s(aLine, L"%u,%S", &lIndex, lName SizeInfo(lName));
-        KMS_EXCEPTION_ASSERT(2 == lRet, RESULT_INVALID_FORMAT, "Invalid bit line", lRet);
 
-        auto lObject = new Object(lName, lIndex, aFlags);
-
-        AddObject(lObject);
+        mDirty = true;
     }
 
     unsigned int ObjectList::FindFreeIndex()
     {
-        if (mMaxQty <= mObjects_ByIndex.size())
+        if (mMaxQty <= mCount)
         {
             char lMsg[64 + NAME_LENGTH];
             sprintf_s(lMsg, "Too many %s (NOT TESTED)", mElementName);
@@ -289,44 +328,78 @@ namespace TRiLOGI
 
         switch (mProjectType)
         {
-        case ProjectType::LEGACY:
-            lResult = mMaxQty - 1;
+        case ProjectType::LEGACY: lResult = mUsed.FindZero_Dec(0, mMaxQty); break;
+        case ProjectType::NEW   : lResult = mUsed.FindZero_Inc(0, mMaxQty); break;
 
-            for (auto lIt = mObjects_ByIndex.rbegin(); lIt != mObjects_ByIndex.rend(); lIt++)
-            {
-                if (lResult > lIt->first)
-                {
-                    break; // NOT TESTED
-                }
+        default: assert(false);
+        }
 
-                if (lResult == lIt->first)
-                {
-                    lResult = lIt->first - 1;
-                }
-            }
-            break;
+        assert(Bitmap::NOT_FOUND != lResult);
 
-        case ProjectType::NEW:
-            lResult = 0;
+        return lResult;
+    }
 
-            for (auto lIt = mObjects_ByIndex.begin(); lIt != mObjects_ByIndex.end(); lIt++)
-            {
-                if (lResult < lIt->first)
-                {
-                    break;
-                }
+    Object* ObjectList::FindObject_ByName(const char* aName, SymbolKind aKind) const
+    {
+        assert(nullptr != mSymbols);
 
-                if (lResult == lIt->first)
-                {
-                    lResult = lIt->first + 1;
-                }
-            }
-            break;
+        return mSymbols->Find(aName, aKind);
+    }
 
-        default: assert(false);
+    bool ObjectList::Insert_ByIndex(Object* aObject, unsigned int aIndex)
+    {
+        assert(nullptr != aObject);
+
+        if (mMaxQty <= aIndex)
+        {
+            char lMsg[64 + NAME_LENGTH];
+            sprintf_s(lMsg, "The %s index %u is not valid (NOT TESTED)", mElementName, aIndex);
+            KMS_EXCEPTION(RESULT_INVALID_INDEX, lMsg, "");
         }
 
-        return lResult;
+        if (mUsed.Test(aIndex))
+        {
+            return false;
+        }
+
+        mObjects_ByIndex[aIndex] = aObject;
+
+        mCount++;
+        mUsed.Set(aIndex);
+
+        return true;
+    }
+
+    bool ObjectList::Insert_ByName(Object* aObject, SymbolKind aKind)
+    {
+        assert(nullptr != mSymbols);
+
+        return mSymbols->Insert(aKind, aObject);
+    }
+
+    void ObjectList::ParseLine(const wchar_t* aLine, unsigned int aFlags)
+    {
+        assert(nullptr != aLine);
+
+        unsigned int lIndex;
+        char         lName[NAME_LENGTH];
+
+        auto lRet = swscanf_s(aLine, L"%u,%S", &lIndex, lName SizeInfo(lName));
+        KMS_EXCEPTION_ASSERT(2 == lRet, RESULT_INVALID_FORMAT, "Invalid bit line", lRet);
+
+        auto lObject = NewObject<Object>(lName, lIndex, aFlags);
+
+        AddObject(lObject);
+    }
+
+    void ObjectList::ReadSnapshotRecord(SnapshotReader* aReader, unsigned int aFlags)
+    {
+        assert(nullptr != aReader);
+
+        auto lIndex = aReader->Get_UInt  ();
+        auto lName  = aReader->Get_String();
+
+        AddObject(NewObject<Object>(lName, lIndex, aFlags));
     }
 
     // NOT TESTED
@@ -335,13 +408,19 @@ namespace TRiLOGI
         assert(nullptr != aOld);
         assert(nullptr != aNew);
         
-        auto lByIndex = mObjects_ByIndex.find(aOld->GetIndex());
-        auto lByName  = mObjects_ByName .find(aOld->GetName ());
+        assert(0 == strcmp(aOld->GetName(), aNew->GetName()));
 
-        lByIndex->second = aNew;
-        lByName ->second = aNew;
+        mObjects_ByIndex[aOld->GetIndex()] = aNew;
 
-        delete aOld;
+        assert(SymbolKind::QTY > mKind);
+
+        mSymbols->Replace(mKind, aNew);
+
+        mDirty = true;
+
+        // The arena destroys aOld when the list is cleared
     }
 
+    void ObjectList::SetDirty() { mDirty = true; }
+
 }
@@ -0,0 +1,1035 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI_Optimizer.cpp
+
+#include "Component.h"
+
+// ===== C++ ================================================================
+#include <algorithm>
+
+// ===== Local ==============================================================
+#include "TRiLOGI/Constant.h"
+#include "TRiLOGI/Optimizer.h"
+
+using namespace KMS;
+
+// Data type and constants
+// //////////////////////////////////////////////////////////////////////////
+
+// TBASIC integers use 32 bits
+#define VALUE_MAX ( 2147483647LL)
+#define VALUE_MIN (-2147483648LL)
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static uint64_t GetLength(const std::vector<std::string>& aLines);
+
+static bool IsNameChar(char aC);
+
+// Return  true when the space between the two characters is needed
+static bool IsSpaceNeeded(char aBefore, char aAfter);
+
+// Return  false when the value is not an integer
+static bool ParseValue(const char* aIn, int64_t* aOut);
+
+static std::string Trim(const std::string& aLine);
+
+namespace TRiLOGI
+{
+
+    // Public
+    // //////////////////////////////////////////////////////////////////////
+
+    Optimizer::Optimizer(const SymbolTable& aSymbols)
+        : mFold(true)
+        , mMinify(false)
+        , mBranchCount(0)
+        , mFoldCount(0)
+        , mLength_After(0)
+        , mLength_Before(0)
+        , mMinifyCount(0)
+        , mLine(nullptr)
+        , mPos(0)
+        , mSymbols(aSymbols)
+    {}
+
+    const std::string& Optimizer::GetReadable() const { return mReadable; }
+
+    void Optimizer::SetFold  (bool aFold  ) { mFold   = aFold; }
+    void Optimizer::SetMinify(bool aMinify) { mMinify = aMinify; }
+
+    void Optimizer::DisplayStats() const
+    {
+        ::Console::Stats(mFoldCount  , "optimized lines");
+        ::Console::Stats(mBranchCount, "constant conditions");
+        ::Console::Stats(mMinifyCount, "minified functions");
+        ::Console::Stats(mLength_Before - mLength_After, "bytes of function code removed");
+    }
+
+    unsigned int Optimizer::Optimize(const char* aFunction, std::vector<std::string>* aLines)
+    {
+        assert(nullptr != aFunction);
+        assert(nullptr != aLines);
+
+        mLength_Before += GetLength(*aLines);
+
+        unsigned int lResult = 0;
+
+        if (mFold)
+        {
+            for (auto& lLine : *aLines)
+            {
+                auto lBefore = lLine;
+
+                if (Fold(&lLine))
+                {
+                    ::Console::Change("Optimized", aFunction, Trim(lBefore).c_str(), Trim(lLine).c_str());
+
+                    mFoldCount++;
+                    lResult++;
+                }
+            }
+
+            lResult += RemoveBranches(aFunction, aLines);
+        }
+
+        if (mMinify)
+        {
+            mReadable += "FUNCTION ";
+            mReadable += aFunction;
+            mReadable += "\n";
+
+            for (const auto& lLine : *aLines)
+            {
+                auto lEnd = lLine.find_last_not_of("\r\n");
+
+                mReadable += (std::string::npos == lEnd) ? std::string() : lLine.substr(0, lEnd + 1);
+                mReadable += "\n";
+            }
+
+            mReadable += "FUNCTION END\n\n";
+
+            auto lBefore = GetLength(*aLines);
+
+            if (Minify(aLines))
+            {
+                char lFrom[32];
+                char lTo  [32];
+
+                sprintf_s(lFrom, "%u bytes", static_cast<unsigned int>(lBefore));
+                sprintf_s(lTo  , "%u bytes", static_cast<unsigned int>(GetLength(*aLines)));
+
+                ::Console::Change("Minified", aFunction, lFrom, lTo);
+
+                mMinifyCount++;
+                lResult++;
+            }
+        }
+
+        mLength_After += GetLength(*aLines);
+
+        return lResult;
+    }
+
+    // Private
+    // //////////////////////////////////////////////////////////////////////
+
+    // Each token able to start an expression starts one. A statement name
+    // like IF or CALL is an operand followed by no operator, so it does
+    // not disturb the parsing of the expression following it.
+    bool Optimizer::Fold(std::string* aLine)
+    {
+        assert(nullptr != aLine);
+
+        Tokenize(*aLine);
+
+        mReplacements.clear();
+
+        mPos = 0;
+
+        while (mTokens.size() > mPos)
+        {
+            auto lStart = mPos;
+
+            switch (mTokens[mPos].mType)
+            {
+            case TokenType::NAME  :
+            case TokenType::NUMBER: Parse_Or(); break;
+
+            case TokenType::OPERATOR:
+                if (IsOperator(mPos, "(") || IsOperator(mPos, "-"))
+                {
+                    Parse_Or();
+                }
+                break;
+
+            default:;
+            }
+
+            if (lStart == mPos)
+            {
+                mPos++;
+            }
+        }
+
+        if (mReplacements.empty())
+        {
+            return false;
+        }
+
+        std::sort(mReplacements.begin(), mReplacements.end(), [](const Replacement& aA, const Replacement& aB) { return aA.mFirst < aB.mFirst; });
+
+        std::string  lResult;
+        unsigned int lOffset = 0;
+
+        for (const auto& lR : mReplacements)
+        {
+            lResult += aLine->substr(lOffset, mTokens[lR.mFirst].mBegin - lOffset);
+            lResult += std::to_string(lR.mValue);
+
+            lOffset = mTokens[lR.mEnd - 1].mEnd;
+        }
+
+        lResult += aLine->substr(lOffset);
+
+        if (lResult == *aLine)
+        {
+            return false;
+        }
+
+        *aLine = lResult;
+
+        return true;
+    }
+
+    // Only the IF blocks using a line for IF ... THEN, ELSE and ENDIF are
+    // recognized. A function containing another form of IF is left as it
+    // is, because its ENDIF could not be matched. A branch containing a
+    // label stays, because a GOTO may reach it.
+    unsigned int Optimizer::RemoveBranches(const char* aFunction, std::vector<std::string>* aLines)
+    {
+        assert(nullptr != aFunction);
+        assert(nullptr != aLines);
+
+        typedef struct
+        {
+            unsigned int mIf;
+            unsigned int mElse;
+            unsigned int mEndIf;
+            int          mCond;
+        }
+        Frame;
+
+        static const unsigned int NO_LINE = 0xffffffff;
+
+        auto lCount = static_cast<unsigned int>(aLines->size());
+
+        std::vector<bool>  lLabel (lCount, false);
+        std::vector<bool>  lRemove(lCount, false);
+        std::vector<Frame> lStack;
+        std::vector<Frame> lFrames;
+
+        for (unsigned int i = 0; i < lCount; i++)
+        {
+            mLine = &(*aLines)[i];
+
+            Tokenize(*mLine);
+
+            auto lTokenCount = static_cast<unsigned int>(mTokens.size());
+
+            for (unsigned int t = 0; t < lTokenCount; t++)
+            {
+                if ((TokenType::OTHER == mTokens[t].mType) && ('@' == (*mLine)[mTokens[t].mBegin]))
+                {
+                    lLabel[i] = true;
+                }
+            }
+
+            if (IsName(0, "IF"))
+            {
+                if (!IsName(lTokenCount - 1, "THEN"))
+                {
+                    return 0;
+                }
+
+                mReplacements.clear();
+                mPos = 1;
+
+                auto lValue = Parse_Or();
+
+                lStack.push_back({ i, NO_LINE, NO_LINE, ((lTokenCount - 1 == mPos) && lValue.mConst) ? ((0 != lValue.mValue) ? 1 : 0) : -1 });
+            }
+            else if ((1 == lTokenCount) && IsName(0, "ELSE"))
+            {
+                if (lStack.empty() || (NO_LINE != lStack.back().mElse))
+                {
+                    return 0;
+                }
+
+                lStack.back().mElse = i;
+            }
+            else if ((1 == lTokenCount) && IsName(0, "ENDIF"))
+            {
+                if (lStack.empty())
+                {
+                    return 0;
+                }
+
+                auto lFrame = lStack.back();
+
+                lStack.pop_back();
+
+                if (0 <= lFrame.mCond)
+                {
+                    lFrame.mEndIf = i;
+
+                    if (NO_LINE == lFrame.mElse)
+                    {
+                        lFrame.mElse = i;
+                    }
+
+                    lFrames.push_back(lFrame);
+                }
+            }
+        }
+
+        if (!lStack.empty())
+        {
+            return 0;
+        }
+
+        unsigned int lResult = 0;
+
+        for (const auto& lFrame : lFrames)
+        {
+            auto lElse  = lFrame.mElse;
+            auto lEndIf = lFrame.mEndIf;
+
+            unsigned int lFirst;
+            unsigned int lEnd;
+
+            // The removed lines are the IF line, the ENDIF line and the
+            // lines from lFirst to lEnd (excluded). Without ELSE, lElse is
+            // the ENDIF line.
+            if (1 == lFrame.mCond) { lFirst = lElse     ; lEnd = lEndIf  ; }
+            else                   { lFirst = lFrame.mIf; lEnd = lElse + 1; }
+
+            auto lKeep = false;
+
+            for (auto i = lFirst; i < lEnd; i++)
+            {
+                lKeep |= lLabel[i];
+            }
+
+            if (!lKeep)
+            {
+                ::Console::Change("Constant condition", aFunction, Trim((*aLines)[lFrame.mIf]).c_str(), (1 == lFrame.mCond) ? "THEN" : ((lElse == lEndIf) ? "nothing" : "ELSE"));
+
+                lRemove[lFrame.mIf] = true;
+                lRemove[lEndIf    ] = true;
+
+                for (auto i = lFirst; i < lEnd; i++)
+                {
+                    lRemove[i] = true;
+                }
+
+                mBranchCount++;
+                lResult++;
+            }
+        }
+
+        if (0 < lResult)
+        {
+            std::vector<std::string> lLines;
+
+            for (unsigned int i = 0; i < lCount; i++)
+            {
+                if (!lRemove[i])
+                {
+                    lLines.push_back((*aLines)[i]);
+                }
+            }
+
+            aLines->swap(lLines);
+        }
+
+        return lResult;
+    }
+
+    // A line keeps its carriage return, the lines the minification empties
+    // are removed.
+    bool Optimizer::Minify(std::vector<std::string>* aLines)
+    {
+        assert(nullptr != aLines);
+
+        std::vector<std::string> lLines;
+
+        for (const auto& lLine : *aLines)
+        {
+            auto lIn   = lLine.c_str();
+            auto lSize = lLine.size();
+
+            std::string lOut;
+            auto        lSpace = false;
+
+            size_t i = 0;
+
+            while (lSize > i)
+            {
+                auto lC = lIn[i];
+
+                if ((' ' == lC) || ('\t' == lC) || ('\r' == lC) || ('\n' == lC))
+                {
+                    lSpace = true;
+                    i++;
+                    continue;
+                }
+
+                if (('\'' == lC) || (('/' == lC) && ('/' == lIn[i + 1])))
+                {
+                    break;
+                }
+
+                auto lEnd = i + 1;
+
+                if ('"' == lC)
+                {
+                    while ((lSize > lEnd) && ('"' != lIn[lEnd]))
+                    {
+                        lEnd++;
+                    }
+
+                    if (lSize > lEnd)
+                    {
+                        lEnd++;
+                    }
+                }
+                else if (IsNameChar(lC))
+                {
+                    while (IsNameChar(lIn[lEnd]))
+                    {
+                        lEnd++;
+                    }
+
+                    if ((3 == lEnd - i) && (0 == _strnicmp("REM", lIn + i, 3)))
+                    {
+                        break;
+                    }
+                }
+
+                if (lSpace && (!lOut.empty()) && IsSpaceNeeded(lOut.back(), lC))
+                {
+                    lOut += ' ';
+                }
+
+                lOut.append(lIn + i, lEnd - i);
+
+                lSpace = false;
+                i = lEnd;
+            }
+
+            if (!lOut.empty())
+            {
+                if ((!lLine.empty()) && ('\r' == lLine.back()))
+                {
+                    lOut += '\r';
+                }
+
+                lLines.push_back(lOut);
+            }
+        }
+
+        if (lLines == *aLines)
+        {
+            return false;
+        }
+
+        aLines->swap(lLines);
+
+        return true;
+    }
+
+    bool Optimizer::IsName(unsigned int aToken, const char* aName) const
+    {
+        assert(nullptr != aName);
+
+        if ((mTokens.size() <= aToken) || (TokenType::NAME != mTokens[aToken].mType))
+        {
+            return false;
+        }
+
+        const auto& lT = mTokens[aToken];
+
+        return (strlen(aName) == lT.mEnd - lT.mBegin) && (0 == _strnicmp(aName, mLine->c_str() + lT.mBegin, lT.mEnd - lT.mBegin));
+    }
+
+    bool Optimizer::IsOperator(unsigned int aToken, const char* aOperator) const
+    {
+        assert(nullptr != aOperator);
+
+        if ((mTokens.size() <= aToken) || (TokenType::OPERATOR != mTokens[aToken].mType))
+        {
+            return false;
+        }
+
+        const auto& lT = mTokens[aToken];
+
+        return (strlen(aOperator) == lT.mEnd - lT.mBegin) && (0 == strncmp(aOperator, mLine->c_str() + lT.mBegin, lT.mEnd - lT.mBegin));
+    }
+
+    // The replacement ends at the current token. It replaces the
+    // replacements it contains.
+    void Optimizer::Record(unsigned int aFirst, int64_t aValue)
+    {
+        assert(aFirst < mPos);
+
+        if ((0 > aValue) || ((aFirst + 1 == mPos) && (TokenType::NUMBER == mTokens[aFirst].mType)))
+        {
+            return;
+        }
+
+        auto lEnd = mPos;
+
+        mReplacements.erase(std::remove_if(mReplacements.begin(), mReplacements.end(),
+            [aFirst, lEnd](const Replacement& aR) { return (aFirst <= aR.mFirst) && (lEnd >= aR.mEnd); }),
+            mReplacements.end());
+
+        mReplacements.push_back({ aFirst, mPos, aValue });
+    }
+
+    // Replacing a constant with its value stays valid, only the folded
+    // expressions are dropped.
+    void Optimizer::DropFolds(unsigned int aFirst, unsigned int aEnd)
+    {
+        mReplacements.erase(std::remove_if(mReplacements.begin(), mReplacements.end(),
+            [aFirst, aEnd](const Replacement& aR) { return (aFirst <= aR.mFirst) && (aEnd >= aR.mEnd) && (aR.mFirst + 1 < aR.mEnd); }),
+            mReplacements.end());
+    }
+
+    // A comment starts with ' , // or REM. A number followed by a letter or
+    // by a dot is not an integer, so it becomes an OTHER token.
+    void Optimizer::Tokenize(const std::string& aLine)
+    {
+        static const char* OPERATORS = "+-*/=<>&|^()[],";
+
+        mLine = &aLine;
+
+        mTokens.clear();
+
+        auto lIn   = aLine.c_str();
+        auto lSize = static_cast<unsigned int>(aLine.size());
+
+        unsigned int i = 0;
+
+        while (lSize > i)
+        {
+            auto lC = lIn[i];
+
+            if ((' ' == lC) || ('\t' == lC) || ('\r' == lC) || ('\n' == lC))
+            {
+                i++;
+                continue;
+            }
+
+            if (('\'' == lC) || (('/' == lC) && ('/' == lIn[i + 1])))
+            {
+                break;
+            }
+
+            Token lT = { TokenType::OTHER, i, i + 1, 0 };
+
+            if (isalpha(static_cast<unsigned char>(lC)) || ('_' == lC))
+            {
+                while (IsNameChar(lIn[lT.mEnd]))
+                {
+                    lT.mEnd++;
+                }
+
+                if ((3 == lT.mEnd - lT.mBegin) && (0 == _strnicmp("REM", lIn + i, 3)))
+                {
+                    break;
+                }
+
+                lT.mType = TokenType::NAME;
+            }
+            else if (isdigit(static_cast<unsigned char>(lC)) || (('&' == lC) && ('H' == toupper(lIn[i + 1])) && isxdigit(static_cast<unsigned char>(lIn[i + 2]))))
+            {
+                while (IsNameChar(lIn[lT.mEnd]) || ('.' == lIn[lT.mEnd]))
+                {
+                    lT.mEnd++;
+                }
+
+                std::string lText(lIn + i, lT.mEnd - i);
+
+                lT.mType = ParseValue(lText.c_str(), &lT.mValue) ? TokenType::NUMBER : TokenType::OTHER;
+            }
+            else if ('"' == lC)
+            {
+                while ((lSize > lT.mEnd) && ('"' != lIn[lT.mEnd]))
+                {
+                    lT.mEnd++;
+                }
+
+                if (lSize > lT.mEnd)
+                {
+                    lT.mEnd++;
+                }
+            }
+            else if (nullptr != strchr(OPERATORS, lC))
+            {
+                // <> , <= and >=
+                if ((('<' == lC) && (('>' == lIn[i + 1]) || ('=' == lIn[i + 1]))) || (('>' == lC) && ('=' == lIn[i + 1])))
+                {
+                    lT.mEnd++;
+                }
+
+                lT.mType = TokenType::OPERATOR;
+            }
+
+            mTokens.push_back(lT);
+
+            i = lT.mEnd;
+        }
+    }
+
+    Optimizer::Value Optimizer::Parse_Or()
+    {
+        auto lResult = Parse_And();
+
+        while (IsName(mPos, "OR"))
+        {
+            mPos++;
+
+            auto lB = Parse_And();
+
+            lResult = { lResult.mConst && lB.mConst, false, false, (0 != lResult.mValue) || (0 != lB.mValue) };
+        }
+
+        return lResult;
+    }
+
+    Optimizer::Value Optimizer::Parse_And()
+    {
+        auto lResult = Parse_Not();
+
+        while (IsName(mPos, "AND"))
+        {
+            mPos++;
+
+            auto lB = Parse_Not();
+
+            lResult = { lResult.mConst && lB.mConst, false, false, (0 != lResult.mValue) && (0 != lB.mValue) };
+        }
+
+        return lResult;
+    }
+
+    Optimizer::Value Optimizer::Parse_Not()
+    {
+        if (IsName(mPos, "NOT"))
+        {
+            mPos++;
+
+            auto lA = Parse_Not();
+
+            return { lA.mConst, false, false, 0 == lA.mValue };
+        }
+
+        return Parse_Compare();
+    }
+
+    Optimizer::Value Optimizer::Parse_Compare()
+    {
+        auto lResult = Parse_Bitwise();
+
+        static const char* OPS[] = { "=", "<>", "<", ">", "<=", ">=" };
+
+        for (unsigned int i = 0; i < sizeof(OPS) / sizeof(OPS[0]); i++)
+        {
+            if (IsOperator(mPos, OPS[i]))
+            {
+                mPos++;
+
+                auto lB = Parse_Bitwise();
+
+                int64_t lValue;
+
+                switch (i)
+                {
+                case 0: lValue = lResult.mValue == lB.mValue; break;
+                case 1: lValue = lResult.mValue != lB.mValue; break;
+                case 2: lValue = lResult.mValue <  lB.mValue; break;
+                case 3: lValue = lResult.mValue >  lB.mValue; break;
+                case 4: lValue = lResult.mValue <= lB.mValue; break;
+                case 5: lValue = lResult.mValue >= lB.mValue; break;
+
+                default: assert(false); lValue = 0;
+                }
+
+                lResult = { lResult.mConst && lResult.mEmit && lB.mConst && lB.mEmit, false, false, lValue };
+                break;
+            }
+        }
+
+        return lResult;
+    }
+
+    // An operand of a bitwise operator is folded only when it is simple,
+    // because the grouping of a + b & c depends on the precedence.
+    Optimizer::Value Optimizer::Parse_Bitwise()
+    {
+        auto lFirst = mPos;
+
+        auto lResult = Parse_Add();
+
+        if (!IsOperator(mPos, "&") && !IsOperator(mPos, "|") && !IsOperator(mPos, "^"))
+        {
+            return lResult;
+        }
+
+        auto lConst = lResult.mConst && lResult.mEmit && lResult.mSimple;
+        auto lOp    = (*mLine)[mTokens[mPos].mBegin];
+
+        if (!lResult.mSimple)
+        {
+            DropFolds(lFirst, mPos);
+        }
+
+        while (IsOperator(mPos, "&") || IsOperator(mPos, "|") || IsOperator(mPos, "^"))
+        {
+            lConst &= (lOp == (*mLine)[mTokens[mPos].mBegin]);
+
+            mPos++;
+
+            auto lStart = mPos;
+
+            auto lB = Parse_Add();
+
+            if (!lB.mSimple)
+            {
+                DropFolds(lStart, mPos);
+            }
+
+            lConst &= lB.mConst && lB.mEmit && lB.mSimple;
+
+            if (lConst)
+            {
+                switch (lOp)
+                {
+                case '&': lResult.mValue &= lB.mValue; break;
+                case '|': lResult.mValue |= lB.mValue; break;
+                case '^': lResult.mValue ^= lB.mValue; break;
+
+                default: assert(false);
+                }
+            }
+        }
+
+        lResult = { lConst, true, false, lResult.mValue };
+
+        if (lConst)
+        {
+            Record(lFirst, lResult.mValue);
+        }
+
+        return lResult;
+    }
+
+    Optimizer::Value Optimizer::Parse_Add()
+    {
+        auto lFirst = mPos;
+
+        auto lResult = Parse_Mul();
+
+        while (IsOperator(mPos, "+") || IsOperator(mPos, "-"))
+        {
+            auto lAdd = IsOperator(mPos, "+");
+
+            mPos++;
+
+            auto lB = Parse_Mul();
+
+            auto lValue = lAdd ? (lResult.mValue + lB.mValue) : (lResult.mValue - lB.mValue);
+
+            lResult = { lResult.mConst && lResult.mEmit && lB.mConst && lB.mEmit && (VALUE_MIN <= lValue) && (VALUE_MAX >= lValue), true, false, lValue };
+
+            if (lResult.mConst)
+            {
+                Record(lFirst, lValue);
+            }
+        }
+
+        return lResult;
+    }
+
+    // A division by zero and a MOD with a negative operand stay as written
+    Optimizer::Value Optimizer::Parse_Mul()
+    {
+        auto lFirst = mPos;
+
+        auto lResult = Parse_Unary();
+
+        for (;;)
+        {
+            char lOp;
+
+            if      (IsOperator(mPos, "*"  )) { lOp = '*'; }
+            else if (IsOperator(mPos, "/"  )) { lOp = '/'; }
+            else if (IsName    (mPos, "MOD")) { lOp = '%'; }
+            else break;
+
+            mPos++;
+
+            auto lB = Parse_Unary();
+
+            auto lConst = lResult.mConst && lResult.mEmit && lB.mConst && lB.mEmit;
+
+            int64_t lValue = 0;
+
+            if (lConst)
+            {
+                switch (lOp)
+                {
+                case '*': lValue = lResult.mValue * lB.mValue; break;
+
+                case '/':
+                    lConst = (0 != lB.mValue);
+                    if (lConst) { lValue = lResult.mValue / lB.mValue; }
+                    break;
+
+                case '%':
+                    lConst = (0 <= lResult.mValue) && (0 < lB.mValue);
+                    if (lConst) { lValue = lResult.mValue % lB.mValue; }
+                    break;
+
+                default: assert(false);
+                }
+            }
+
+            lResult = { lConst && (VALUE_MIN <= lValue) && (VALUE_MAX >= lValue), true, false, lValue };
+
+            if (lResult.mConst)
+            {
+                Record(lFirst, lValue);
+            }
+        }
+
+        return lResult;
+    }
+
+    Optimizer::Value Optimizer::Parse_Unary()
+    {
+        if (IsOperator(mPos, "-"))
+        {
+            mPos++;
+
+            auto lA = Parse_Unary();
+
+            return { lA.mConst && lA.mEmit && (VALUE_MIN < lA.mValue), true, false, -lA.mValue };
+        }
+
+        return Parse_Primary();
+    }
+
+    // A name followed by ( or [ is a function or an array, the arguments
+    // are parsed as expressions.
+    Optimizer::Value Optimizer::Parse_Primary()
+    {
+        Value lResult = { false, true, true, 0 };
+
+        if (mTokens.size() <= mPos)
+        {
+            return lResult;
+        }
+
+        auto        lFirst = mPos;
+        const auto& lT     = mTokens[mPos];
+
+        switch (lT.mType)
+        {
+        case TokenType::NUMBER:
+            mPos++;
+            lResult.mConst = true;
+            lResult.mValue = lT.mValue;
+            break;
+
+        case TokenType::NAME:
+            mPos++;
+            if (IsOperator(mPos, "(") || IsOperator(mPos, "["))
+            {
+                auto lClose = IsOperator(mPos, "(") ? ")" : "]";
+
+                do
+                {
+                    mPos++;
+
+                    Parse_Or();
+                }
+                while (IsOperator(mPos, ","));
+
+                if (IsOperator(mPos, lClose))
+                {
+                    mPos++;
+                }
+            }
+            else
+            {
+                std::string lName(mLine->c_str() + lT.mBegin, lT.mEnd - lT.mBegin);
+
+                auto lConstant = static_cast<const Constant*>(mSymbols.Find(lName.c_str(), SymbolKind::CONSTANT));
+                if ((nullptr != lConstant) && ParseValue(lConstant->GetValue(), &lResult.mValue))
+                {
+                    lResult.mConst = true;
+
+                    Record(lFirst, lResult.mValue);
+                }
+            }
+            break;
+
+        case TokenType::OPERATOR:
+            if (IsOperator(mPos, "("))
+            {
+                mPos++;
+
+                auto lValue = Parse_Or();
+
+                if (IsOperator(mPos, ")"))
+                {
+                    mPos++;
+
+                    lResult = { lValue.mConst, lValue.mEmit, true, lValue.mValue };
+
+                    if (lResult.mConst && lResult.mEmit)
+                    {
+                        Record(lFirst, lResult.mValue);
+                    }
+                }
+            }
+            break;
+
+        default:;
+        }
+
+        return lResult;
+    }
+
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+uint64_t GetLength(const std::vector<std::string>& aLines)
+{
+    uint64_t lResult = 0;
+
+    for (const auto& lLine : aLines)
+    {
+        lResult += lLine.size() + 1;
+    }
+
+    return lResult;
+}
+
+bool IsNameChar(char aC)
+{
+    return isalnum(static_cast<unsigned char>(aC)) || ('_' == aC) || ('$' == aC);
+}
+
+// Two words stay separated. A word is a name, a number, a string, a label
+// (@) or a channel (#). A & followed by a letter could become a
+// hexadecimal value and two operators could become one.
+bool IsSpaceNeeded(char aBefore, char aAfter)
+{
+    static const char* WORD_CHARS = "\".@#";
+
+    auto lA = IsNameChar(aBefore) || (nullptr != strchr(WORD_CHARS, aBefore));
+    auto lB = IsNameChar(aAfter ) || (nullptr != strchr(WORD_CHARS, aAfter ));
+
+    if (lA && lB)
+    {
+        return true;
+    }
+
+    if ('&' == aBefore)
+    {
+        return lB;
+    }
+
+    return !(lA || lB);
+}
+
+// A decimal or hexadecimal (&H) value, optionally negative
+bool ParseValue(const char* aIn, int64_t* aOut)
+{
+    assert(nullptr != aIn);
+    assert(nullptr != aOut);
+
+    auto lIn = aIn;
+
+    while (' ' == *lIn) { lIn++; }
+
+    auto lNegative = ('-' == *lIn);
+    if (lNegative) { lIn++; }
+
+    unsigned int lBase = 10;
+
+    if (('&' == lIn[0]) && ('H' == toupper(lIn[1])))
+    {
+        lBase = 16;
+        lIn += 2;
+    }
+
+    if (!isxdigit(static_cast<unsigned char>(*lIn)))
+    {
+        return false;
+    }
+
+    int64_t lValue = 0;
+
+    while (isxdigit(static_cast<unsigned char>(*lIn)))
+    {
+        auto lC = toupper(*lIn);
+
+        unsigned int lDigit = isdigit(lC) ? (lC - '0') : (lC - 'A' + 10);
+        if (lBase <= lDigit)
+        {
+            return false;
+        }
+
+        lValue = lValue * lBase + lDigit;
+        if (VALUE_MAX < lValue)
+        {
+            return false;
+        }
+
+        lIn++;
+    }
+
+    while (' ' == *lIn) { lIn++; }
+
+    if ('\0' != *lIn)
+    {
+        return false;
+    }
+
+    *aOut = lNegative ? -lValue : lValue;
+
+    return true;
+}
+
+std::string Trim(const std::string& aLine)
+{
+    auto lBegin = aLine.find_first_not_of(" \t");
+    auto lEnd   = aLine.find_last_not_of(" \t\r\n");
+
+    if (std::string::npos == lBegin)
+    {
+        return std::string();
+    }
+
+    return aLine.substr(lBegin, lEnd - lBegin + 1);
+}
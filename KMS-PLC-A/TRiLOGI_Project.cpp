@@ -10,37 +10,59 @@
 #include "Component.h"
 
 // ===== C++ ================================================================
-#include <fstream>
+#include <algorithm>
+#include <future>
+#include <sstream>
+#include <unordered_map>
 
 // ===== Import/Includes ====================================================
 #include <KMS/Cfg/MetaData.h>
 #include <KMS/Console/HumanScript.h>
-#include <KMS/Text/File_ASCII.h>
 
 // ===== Local ==============================================================
 #include "../Common/Version.h"
 
+#include "../Common/PerfectHash.h"
+#include "../Common/Snapshot.h"
+#include "../Common/SymbolFile.h"
+
 #include "../Common/TRiLOGI/Project.h"
 
+#include "TRiLOGI/Lexer.h"
+#include "TRiLOGI/Optimizer.h"
 #include "TRiLOGI/PC6.h"
-#include "TRiLOGI/PC6_in0.h"
+#include "TRiLOGI/Reachability.h"
+#include "TRiLOGI/UsageCounter.h"
 #include "TRiLOGI/Word.h"
+#include "TRiLOGI/WordRelocation.h"
+
+#include "DepFile.h"
+#include "Utilities.h"
 
 using namespace KMS;
 
+KMS_RESULT_STATIC(RESULT_SCAN_TIME_BUDGET);
+
 // Constants
 // //////////////////////////////////////////////////////////////////////////
 
+static const Cfg::MetaData MD_COMPACT           ("Compact = false | true");
 static const Cfg::MetaData MD_COMPILED_FILE_NAME("CompiledFileName = {Path}.CO5");
 static const Cfg::MetaData MD_CREATE_IF_NEEDED  ("CreateIfNeeded = false | true");
 static const Cfg::MetaData MD_EXPORTED          ("Exported = {Path}.PC6.txt");
 static const Cfg::MetaData MD_FILE_NAME         ("FileName = {Path}.PC6");
 static const Cfg::MetaData MD_HEADER_FILE       ("HeaderFile = {Path}.h");
 static const Cfg::MetaData MD_HEADER_PREFIX     ("HeaderPrefix = {Prefix}");
+static const Cfg::MetaData MD_HEADER_TYPE       ("HeaderType = DEFINE | CONSTEXPR");
 static const Cfg::MetaData MD_ID                ("Id = {Id}");
 static const Cfg::MetaData MD_IP_ADDRESS        ("IPAddress = {A.B.C.D}");
+static const Cfg::MetaData MD_MINIFY            ("Minify = false | true");
+static const Cfg::MetaData MD_OPTIMIZE          ("Optimize = false | true");
 static const Cfg::MetaData MD_PROJECT_TYPE      ("ProjectType = LEGACY | NEW");
+static const Cfg::MetaData MD_READABLE_FILE     ("ReadableFile = {Path}.PC6.txt");
+static const Cfg::MetaData MD_SNAPSHOT_FILE     ("SnapshotFile = {Path}");
 static const Cfg::MetaData MD_SOURCES           ("Sources += {Path}.PC6.txt");
+static const Cfg::MetaData MD_SYMBOL_FILE       ("SymbolFile = {Path}.sym");
 static const Cfg::MetaData MD_TOOL_CONFIG       ("HeaderFile = {Path}.cfg");
 
 // Static function declarations
@@ -48,37 +70,58 @@ static const Cfg::MetaData MD_TOOL_CONFIG       ("HeaderFile = {Path}.cfg");
 
 static void Instruction_Write();
 
+static bool IsLineSection(TRiLOGI::SectionId aId);
+
+static bool WriteText(const char* aFileName, const std::string& aText);
+
 namespace TRiLOGI
 {
 
     // Public
     // //////////////////////////////////////////////////////////////////////
 
+    const bool        Project::COMPACT_DEFAULT            = false;
     const char      * Project::COMPILED_FILE_NAME_DEFAULT = "";
     const bool        Project::CREATE_IF_NEEDED_DEFAULT   = false;
     const char      * Project::EXPORTED_DEFAULT           = "";
     const char      * Project::FILE_NAME_DEFAULT          = "";
     const char      * Project::HEADER_FILE_DEFAULT        = "";
     const char      * Project::HEADER_PREFIX_DEFAULT      = "";
+    const HeaderType  Project::HEADER_TYPE_DEFAULT        = HeaderType::DEFINE;
     const uint8_t     Project::ID_DEFAULT                 = 1;
     const char      * Project::IP_ADDRESS_DEFAULT         = "";
+    const bool        Project::MINIFY_DEFAULT             = false;
+    const bool        Project::OPTIMIZE_DEFAULT           = false;
     const ProjectType Project::PROJECT_TYPE_DEFAULT       = ProjectType::LEGACY;
+    const char      * Project::READABLE_FILE_DEFAULT      = "";
+    const char      * Project::SNAPSHOT_FILE_DEFAULT      = "";
+    const char      * Project::SYMBOL_FILE_DEFAULT        = "";
     const char      * Project::TOOL_CONFIG_DEFAULT        = "";
 
     Project::Project()
-        : mCompiledFileName(COMPILED_FILE_NAME_DEFAULT)
+        : mCompact         (COMPACT_DEFAULT)
+        , mCompiledFileName(COMPILED_FILE_NAME_DEFAULT)
         , mCreateIfNeeded  (CREATE_IF_NEEDED_DEFAULT)
         , mExported        (EXPORTED_DEFAULT)
         , mFileName        (FILE_NAME_DEFAULT)
         , mHeaderFile      (HEADER_FILE_DEFAULT)
         , mHeaderPrefix    (HEADER_PREFIX_DEFAULT)
+        , mHeaderType      (HEADER_TYPE_DEFAULT)
         , mId              (ID_DEFAULT)
         , mIPAddress       (IP_ADDRESS_DEFAULT)
+        , mMinify          (MINIFY_DEFAULT)
+        , mOptimize        (OPTIMIZE_DEFAULT)
         , mProjectType     (PROJECT_TYPE_DEFAULT)
+        , mReadableFile    (READABLE_FILE_DEFAULT)
+        , mSnapshotFile    (SNAPSHOT_FILE_DEFAULT)
+        , mSymbolFile      (SYMBOL_FILE_DEFAULT)
         , mToolConfig      (TOOL_CONFIG_DEFAULT)
-        , mInputs ("input" ,    1, 256)
-        , mOutputs("output",    1, 256)
-        , mRelays ("relay" , 1025, 512)
+        , mCompacted(false)
+        , mImported(false)
+        , mSnapshot_Offset_byte(0)
+        , mInputs ("input" , SymbolKind::INPUT ,    1, 256)
+        , mOutputs("output", SymbolKind::OUTPUT,    1, 256)
+        , mRelays ("relay" , SymbolKind::RELAY , 1025, 512)
         // ===== Callbacks ==================================================
         , ON_PROJECT_TYPE_CHANGED(this, &Project::OnProjectTypeChanged)
     {
@@ -88,36 +131,56 @@ namespace TRiLOGI
 
         Ptr_OF<DI::Object> lEntry;
 
+        lEntry.Set(&mCompact         , false); AddEntry("Compact"         , lEntry, &MD_COMPACT);
         lEntry.Set(&mCompiledFileName, false); AddEntry("CompiledFileName", lEntry, &MD_COMPILED_FILE_NAME);
         lEntry.Set(&mCreateIfNeeded  , false); AddEntry("CreateIfNeeded"  , lEntry, &MD_CREATE_IF_NEEDED);
         lEntry.Set(&mExported        , false); AddEntry("Exported"        , lEntry, &MD_EXPORTED);
         lEntry.Set(&mFileName        , false); AddEntry("FileName"        , lEntry, &MD_FILE_NAME);
         lEntry.Set(&mHeaderFile      , false); AddEntry("HeaderFile"      , lEntry, &MD_HEADER_FILE);
         lEntry.Set(&mHeaderPrefix    , false); AddEntry("HeaderPrefix"    , lEntry, &MD_HEADER_PREFIX);
+        lEntry.Set(&mHeaderType      , false); AddEntry("HeaderType"      , lEntry, &MD_HEADER_TYPE);
         lEntry.Set(&mId              , false); AddEntry("Id"              , lEntry, &MD_ID);
         lEntry.Set(&mIPAddress       , false); AddEntry("IPAddress"       , lEntry, &MD_IP_ADDRESS);
+        lEntry.Set(&mMinify          , false); AddEntry("Minify"          , lEntry, &MD_MINIFY);
+        lEntry.Set(&mOptimize        , false); AddEntry("Optimize"        , lEntry, &MD_OPTIMIZE);
         lEntry.Set(&mProjectType     , false); AddEntry("ProjectType"     , lEntry, &MD_PROJECT_TYPE);
+        lEntry.Set(&mReadableFile    , false); AddEntry("ReadableFile"    , lEntry, &MD_READABLE_FILE);
+        lEntry.Set(&mScanTime        , false); AddEntry("ScanTime"        , lEntry);
+        lEntry.Set(&mSnapshotFile    , false); AddEntry("SnapshotFile"    , lEntry, &MD_SNAPSHOT_FILE);
         lEntry.Set(&mSources         , false); AddEntry("Sources"         , lEntry, &MD_SOURCES);
+        lEntry.Set(&mSymbolFile      , false); AddEntry("SymbolFile"      , lEntry, &MD_SYMBOL_FILE);
         lEntry.Set(&mToolConfig      , false); AddEntry("ToolConfig"      , lEntry, &MD_TOOL_CONFIG);
 
         lEntry.Set(&mDefines.mWords, false); AddEntry("Words", lEntry);
+
+        mCounters .SetSymbolTable(&mSymbols);
+        mDefines  .SetSymbolTable(&mSymbols);
+        mFunctions.SetSymbolTable(&mSymbols);
+        mInputs   .SetSymbolTable(&mSymbols);
+        mOutputs  .SetSymbolTable(&mSymbols);
+        mRelays   .SetSymbolTable(&mSymbols);
+        mTimers   .SetSymbolTable(&mSymbols);
     }
 
+    bool Project::IsImported() const { return mImported; }
+
     bool Project::IsValid() const { return 0 < mFile.GetLineCount(); }
 
     void Project::Clean()
     {
         ::Console::Progress_Begin("TRiLOGY", "Cleaning ...");
 
+        Verify_Reachability();
+
         unsigned int lCount = 0;
 
-        lCount += mDefines .Clean();
-        // TODO Functions
-        lCount += mCounters.Clean();
-        lCount += mTimers  .Clean();
-        lCount += mRelays  .Clean();
-        lCount += mOutputs .Clean();
-        lCount += mInputs  .Clean();
+        lCount += mDefines  .Clean();
+        lCount += mFunctions.Clean();
+        lCount += mCounters .Clean();
+        lCount += mTimers   .Clean();
+        lCount += mRelays   .Clean();
+        lCount += mOutputs  .Clean();
+        lCount += mInputs   .Clean();
 
         if (0 < lCount)
         {
@@ -148,13 +211,22 @@ namespace TRiLOGI
 
     void Project::Export()
     {
+        bool lChanged;
+
         if (0 < mExported.GetLength())
         {
             ::Console::Progress_Begin("TRiLOGY", "Exporting", mExported.Get());
             {
-                mFile.Write_ASCII(File::Folder::CURRENT, mExported.Get());
+                if (mCompacted)
+                {
+                    BuildFile();
+                }
+
+                lChanged = mFile.Write_ASCII(File::Folder::CURRENT, mExported.Get());
+
+                DepFile::AddOutput(mExported.Get());
             }
-            ::Console::Progress_End("Exported");
+            ::Console::Progress_End(lChanged ? "Exported" : "Exported (No change)");
         }
 
         if (0 < mHeaderFile.GetLength())
@@ -162,6 +234,11 @@ namespace TRiLOGI
             Export_HeaderFile();
         }
 
+        if (0 < mSymbolFile.GetLength())
+        {
+            Export_SymbolFile();
+        }
+
         if (0 < mToolConfig.GetLength())
         {
             Export_ToolConfig();
@@ -172,16 +249,42 @@ namespace TRiLOGI
     {
         ::Console::Progress_Begin("TRiLOGY", "Importing sources");
 
+        // The sources give all the public addresses again
+        mPublicAddresses.clear();
+
         auto lChanged = ProjectType::NEW == mProjectType;
 
+        auto lOptimize = mOptimize || mMinify;
+
+        Optimizer lOptimizer(mSymbols);
+
+        lOptimizer.SetFold  (mOptimize);
+        lOptimizer.SetMinify(mMinify);
+
         for (const auto& lEntry : mSources.mInternal)
         {
             auto lSource = dynamic_cast<const DI::String*>(lEntry.Get());
             assert(nullptr != lSource);
 
-            lChanged |= Import_Source(lSource->Get());
+            lChanged |= Import_Source(lSource->Get(), lOptimize ? &lOptimizer : nullptr);
+        }
+
+        if (lOptimize)
+        {
+            lOptimizer.DisplayStats();
+        }
+
+        // The readable file contains the code of the minified functions as
+        // the PLC executes it, with the comments and the indentation.
+        if (mMinify && (0 < mReadableFile.GetLength()))
+        {
+            WriteText(mReadableFile.Get(), lOptimizer.GetReadable());
         }
 
+        AddPublicAddresses();
+
+        mImported = true;
+
         if (lChanged)
         {
             BuildFile();
@@ -243,13 +346,158 @@ namespace TRiLOGI
         {
             ::Console::Progress_Begin("TRiLOGY", "Reading", mFileName.Get());
             {
-                mFile.Clear();
-                mFile.Read(File::Folder::CURRENT, mFileName.Get(), Text::File::FLAG_DO_NOT_REMOVE_CR);
+                // Read releases the buffer the LineList refer to. They are
+                // cleared first and the caller parses the file again.
+                mCircuits .ClearList();
+                mQuickTags.ClearList();
+                mFooter   .ClearList();
+
+                if (!ReadSnapshot())
+                {
+                    mFile.Read(File::Folder::CURRENT, mFileName.Get());
+                }
+
+                mCompacted = false;
+
+                mSections.Clear();
+
+                DepFile::AddInput(mFileName.Get());
             }
             ::Console::Progress_End("Read");
         }
     }
 
+    void Project::Relocate_Words()
+    {
+        ::Console::Progress_Begin("TRiLOGY", "Relocating the public words");
+
+        // The Modbus 4x address of DM[n] is 1000 + n. A word having many
+        // public names is moved once.
+        std::vector<unsigned int> lOffsets;
+
+        for (const auto& lAddr : mPublicAddresses)
+        {
+            if ((AddressType::MODBUS_RTU_4X == lAddr.GetType()) && (1000 < lAddr.GetAddress()))
+            {
+                auto lOffset = lAddr.GetAddress() - 1000;
+
+                if ((nullptr != mDefines.mWords.Find_ByOffset(lOffset)) && (lOffsets.end() == std::find(lOffsets.begin(), lOffsets.end(), lOffset)))
+                {
+                    lOffsets.push_back(lOffset);
+                }
+            }
+        }
+
+        WordRelocation lRelocation;
+
+        if (mDefines.RelocateWords(lOffsets, &lRelocation))
+        {
+            mCircuits .RelocateWords(&lRelocation);
+            mFunctions.RelocateWords(&lRelocation);
+
+            for (auto& lAddr : mPublicAddresses)
+            {
+                if ((AddressType::MODBUS_RTU_4X == lAddr.GetType()) && (1000 < lAddr.GetAddress()))
+                {
+                    auto lTo = lRelocation.GetTo(lAddr.GetAddress() - 1000);
+                    if (0 != lTo)
+                    {
+                        lAddr = Address(lAddr.GetName(), AddressType::MODBUS_RTU_4X, static_cast<uint16_t>(1000 + lTo));
+                    }
+                }
+            }
+
+            ::Console::Stats(lRelocation.GetRewriteCount(), "DM accesses rewritten");
+
+            if (0 < lRelocation.GetIndirectCount())
+            {
+                ::Console::Warning_Begin()
+                    << lRelocation.GetIndirectCount() << " DM accesses use an expression, verify they do not access a relocated word";
+                ::Console::Warning_End();
+            }
+
+            BuildFile();
+            Verify();
+
+            ::Console::Progress_End("Relocated");
+
+            if (0 < mHeaderFile.GetLength())
+            {
+                Export_HeaderFile();
+            }
+
+            if (0 < mSymbolFile.GetLength())
+            {
+                Export_SymbolFile();
+            }
+
+            if (0 < mToolConfig.GetLength())
+            {
+                Export_ToolConfig();
+            }
+
+            switch (mProjectType)
+            {
+            case ProjectType::LEGACY: Instruction_Write(); break;
+            case ProjectType::NEW   :             Write(); break;
+
+            default: assert(false);
+            }
+        }
+        else
+        {
+            ::Console::Progress_End("Relocated (No change)");
+        }
+    }
+
+    void Project::Report_ScanTime()
+    {
+        std::ostringstream lReport;
+
+        ::Console::Progress_Begin("TRiLOGY", "Estimating the scan time", mFileName.Get());
+
+        auto lTotal_us = mScanTime.Report(lReport, mSymbols, mCircuits, &mFunctions);
+
+        ::Console::Progress_End("Estimated");
+
+        std::cout << lReport.str();
+
+        if ((0 < mScanTime.mBudget_us) && (mScanTime.mBudget_us < lTotal_us))
+        {
+            ::Console::Error_Begin()
+                << "The estimated scan time (" << lTotal_us << " us) exceeds the budget (" << mScanTime.mBudget_us.Get() << " us)";
+            ::Console::Error_End();
+
+            KMS_EXCEPTION(RESULT_SCAN_TIME_BUDGET, "The estimated scan time exceeds the budget", static_cast<unsigned int>(lTotal_us));
+        }
+    }
+
+    void Project::Restore(const char* aDelta)
+    {
+        assert(nullptr != aDelta);
+
+        KMS_EXCEPTION_ASSERT(0 < mFileName.GetLength(), RESULT_INVALID_CONFIG, "No file name configured", "");
+
+        ::Console::Progress_Begin("TRiLOGY", "Restoring", aDelta);
+        {
+            char lBackup[PATH_LENGTH];
+
+            sprintf_s(lBackup, "%s.bak", mFileName.Get());
+
+            std::vector<uint8_t> lData;
+
+            Utl_Delta_Restore(File::Folder::CURRENT, lBackup, aDelta, &lData);
+
+            Utl_ReplaceFile(File::Folder::CURRENT, mFileName.Get(), lData, lBackup);
+
+            DepFile::AddOutput(mFileName.Get());
+        }
+        ::Console::Progress_End("Restored");
+
+        Read();
+        Reparse();
+    }
+
     void Project::Verify()
     {
         if (0 < mFile.GetLineCount())
@@ -259,13 +507,44 @@ namespace TRiLOGI
                 // TODO For the verification, use a version of mFile_PC6 without
                 //      comment
 
-                mCounters  .Verify(mFile, &mPublicAddresses);
-                mDefines   .Verify(mFile, &mPublicAddresses);
-                mFunctions .Verify(mFile);
-                mInputs    .Verify(mFile, &mPublicAddresses);
-                mOutputs   .Verify(mFile, &mPublicAddresses);
-                mRelays    .Verify(mFile, &mPublicAddresses);
-                mTimers    .Verify(mFile, &mPublicAddresses);
+                UsageCounter lUsage;
+
+                mCounters  .AddNames(&lUsage);
+                mDefines   .AddNames(&lUsage);
+                mFunctions .AddNames(&lUsage);
+                mInputs    .AddNames(&lUsage);
+                mOutputs   .AddNames(&lUsage);
+                mRelays    .AddNames(&lUsage);
+                mTimers    .AddNames(&lUsage);
+
+                lUsage.Count(mFile);
+
+                if (mCompacted)
+                {
+                    // The objects format the removed sections in a
+                    // temporary file.
+                    File_PC6 lFile;
+
+                    for (unsigned int i = 0; i < static_cast<unsigned int>(SectionId::QTY); i++)
+                    {
+                        auto lId = static_cast<SectionId>(i);
+
+                        if (!IsLineSection(lId))
+                        {
+                            BuildSection(lId, &lFile);
+                        }
+                    }
+
+                    lUsage.Count(lFile);
+                }
+
+                mCounters  .Verify(lUsage, &mPublicAddresses);
+                mDefines   .Verify(lUsage, &mPublicAddresses);
+                mFunctions .Verify(lUsage);
+                mInputs    .Verify(lUsage, &mPublicAddresses);
+                mOutputs   .Verify(lUsage, &mPublicAddresses);
+                mRelays    .Verify(lUsage, &mPublicAddresses);
+                mTimers    .Verify(lUsage, &mPublicAddresses);
             }
             ::Console::Progress_End("Verified");
         }
@@ -330,15 +609,26 @@ namespace TRiLOGI
     void Project::Write()
     {
         ::Console::Progress_Begin("TRiLOGY", "Writing");
+
+        char lBackup[PATH_LENGTH];
+
+        sprintf_s(lBackup, "%s.bak", mFileName.Get());
+
+        DepFile::AddOutput(mFileName.Get());
+
+        if (mCompacted)
         {
-            if (File::Folder::CURRENT.DoesFileExist(mFileName.Get()))
-            {
-                File::Folder::CURRENT.Backup(mFileName.Get(), File::Folder::FLAG_BACKUP_RENAME);
-            }
+            BuildFile();
+        }
 
-            mFile.Write(File::Folder::CURRENT, mFileName.Get(), L"\n");
+        if (mFile.Write(File::Folder::CURRENT, mFileName.Get(), lBackup))
+        {
+            ::Console::Progress_End("Written");
+        }
+        else
+        {
+            ::Console::Progress_End("Written (No change)");
         }
-        ::Console::Progress_End("Written");
     }
 
     const AddressList* Project::GetPublicAddresses() const
@@ -391,20 +681,30 @@ namespace TRiLOGI
     {
         assert(nullptr != aPrivate);
 
-        auto lObj = mInputs.FindObject_ByName(aPrivate);
-        if (nullptr == lObj)
+        TRiLOGI::Object* lObj = nullptr;
+
+        auto lSymbol = mSymbols.Find(aPrivate);
+        if (nullptr != lSymbol)
         {
-            lObj = mOutputs.FindObject_ByName(aPrivate);
+            lObj = lSymbol->GetObject(SymbolKind::INPUT);
             if (nullptr == lObj)
             {
-                lObj = mRelays.FindObject_ByName(aPrivate);
+                lObj = lSymbol->GetObject(SymbolKind::OUTPUT);
+                if (nullptr == lObj)
+                {
+                    lObj = lSymbol->GetObject(SymbolKind::RELAY);
+                }
             }
         }
 
         if (nullptr == lObj)
         {
-            lObj = mDefines.FindObject_ByName(aPrivate);
-            if (nullptr == lObj)
+            auto lWord = (nullptr == lSymbol) ? nullptr : static_cast<Word*>(lSymbol->GetObject(SymbolKind::WORD));
+            if (nullptr != lWord)
+            {
+                mPublicAddresses.Add(aPublic, AddressType::MODBUS_RTU_4X, 1000 + lWord->GetOffset());
+            }
+            else if ((nullptr == lSymbol) || (nullptr == lSymbol->GetObject(SymbolKind::CONSTANT)))
             {
                 ::Console::Warning_Begin()
                     << "No object named " << aPrivate;
@@ -412,17 +712,9 @@ namespace TRiLOGI
             }
             else
             {
-                auto lWord = dynamic_cast<Word*>(lObj);
-                if (nullptr == lWord)
-                {
-                    ::Console::Warning_Begin()
-                        << "The object " << aPrivate << " is not of an expected type";
-                    ::Console::Warning_End();
-                }
-                else
-                {
-                    mPublicAddresses.Add(aPublic, AddressType::MODBUS_RTU_4X, lWord->GetOffset());
-                }
+                ::Console::Warning_Begin()
+                    << "The object " << aPrivate << " is not of an expected type";
+                ::Console::Warning_End();
             }
         }
         else
@@ -431,45 +723,184 @@ namespace TRiLOGI
         }
     }
 
-    void Project::AddPublicAddresses(const char* aRegEx)
+    // Each name is matched once against the expressions of all the
+    // sources. The addresses are then added in the order of the statements.
+    //
+    // The generated header and the symbol file need unique public names, so
+    // only the first address of a name is kept.
+    void Project::AddPublicAddresses()
     {
-        assert(nullptr != aRegEx);
+        std::vector<AddressList> lMatches(mPatterns.GetCount());
+
+        if (0 < mPatterns.GetCount())
+        {
+            mInputs .GetAddresses(&mPatterns, &lMatches);
+            mOutputs.GetAddresses(&mPatterns, &lMatches);
+            mRelays .GetAddresses(&mPatterns, &lMatches);
 
-        auto lCount = mPublicAddresses.size();
+            mDefines.mWords.GetAddresses(&mPatterns, &lMatches);
+        }
 
-        std::regex lRegEx(aRegEx);
+        for (const auto& lStatement : mAddressStatements)
+        {
+            if (!lStatement.mPrivate.empty())
+            {
+                AddPublicAddress(lStatement.mPrivate.c_str(), lStatement.mPublic.c_str());
+                continue;
+            }
 
-        mInputs .GetAddresses(lRegEx, &mPublicAddresses);
-        mOutputs.GetAddresses(lRegEx, &mPublicAddresses);
-        mRelays .GetAddresses(lRegEx, &mPublicAddresses);
+            auto& lList = lMatches[lStatement.mPattern];
+            if (lList.empty())
+            {
+                ::Console::Warning_Begin()
+                    << "The expression \"" << lStatement.mPublic << "\" does not match any name";
+                ::Console::Warning_End();
+            }
+            else
+            {
+                mPublicAddresses.splice(mPublicAddresses.end(), lList);
+            }
+        }
 
-        mDefines.mWords.GetAddresses(lRegEx, &mPublicAddresses);
+        std::unordered_map<std::string, const Address*> lNames;
 
-        if (mPublicAddresses.size() == lCount)
+        for (auto lIt = mPublicAddresses.begin(); lIt != mPublicAddresses.end();)
         {
-            ::Console::Warning_Begin()
-                << "The expression \"" << aRegEx << "\" does not match any name";
-            ::Console::Warning_End();
+            auto lInsert = lNames.insert(std::make_pair(std::string(lIt->GetName()), &*lIt));
+            if (lInsert.second)
+            {
+                lIt++;
+                continue;
+            }
+
+            auto lFirst = lInsert.first->second;
+
+            if ((lFirst->GetType() != lIt->GetType()) || (lFirst->GetAddress() != lIt->GetAddress()))
+            {
+                ::Console::Warning_Begin()
+                    << "The public name " << lIt->GetName() << " designates more than one address, the address " << lIt->GetAddress() << " is ignored";
+                ::Console::Warning_End();
+            }
+
+            lIt = mPublicAddresses.erase(lIt);
         }
+
+        mAddressStatements.clear();
+        mPatterns.Clear();
     }
 
+    // Only the dirty lists are formatted again. The other sections are
+    // added back as they are in the previous content of the file.
     void Project::BuildFile()
     {
+        auto lValid = mSections.IsValid();
+
+        mFile.Clear();
+
+        mFile.AddLine_View(PC6_FILE_HEADER);
+
+        auto lSection = [this, lValid](auto* aList, SectionId aId, const wchar_t* aEnd)
+        {
+            auto lFirst = mFile.GetLineCount();
+
+            if (lValid && !aList->IsDirty() && (!mCompacted || IsLineSection(aId)))
+            {
+                mFile.AddLines_Previous(mSections.GetFirst(aId), mSections.GetEnd(aId));
+            }
+            else
+            {
+                BuildSection(aId, &mFile);
+            }
+
+            mSections.Set(aId, lFirst, mFile.GetLineCount());
+
+            if (nullptr != aEnd)
+            {
+                mFile.AddLine_View(aEnd);
+            }
+        };
+
+        lSection(&mInputs   , SectionId::INPUTS        , PC6_SECTION_END);
+        lSection(&mOutputs  , SectionId::OUTPUTS       , PC6_SECTION_END);
+        lSection(&mRelays   , SectionId::RELAYS        , PC6_SECTION_END);
+        lSection(&mTimers   , SectionId::TIMERS        , PC6_SECTION_END);
+        lSection(&mCounters , SectionId::COUNTERS      , PC6_SECTION_END);
+        lSection(&mCircuits , SectionId::CIRCUITS      , PC6_SECTION_END_CIRCUIT);
+        lSection(&mFunctions, SectionId::FUNCTIONS     , PC6_SECTION_END_CUSTFN);
+        lSection(&mFunctions, SectionId::FUNCTION_NAMES, PC6_SECTION_END_CUSTFNLABEL);
+        lSection(&mQuickTags, SectionId::QUICK_TAGS    , PC6_SECTION_END_QUICKTAGS);
+        lSection(&mDefines  , SectionId::DEFINES       , PC6_SECTION_END_DEFINES);
+        lSection(&mFooter   , SectionId::FOOTER        , nullptr);
+
+        mCompacted = false;
+
+        ClearDirty();
+
+        Parse_LineLists();
+    }
+
+    void Project::BuildSection(SectionId aId, File_PC6* aFile_PC6)
+    {
+        assert(nullptr != aFile_PC6);
+
+        switch (aId)
+        {
+        case SectionId::INPUTS        : mInputs   .AddToFile    (aFile_PC6); break;
+        case SectionId::OUTPUTS       : mOutputs  .AddToFile    (aFile_PC6); break;
+        case SectionId::RELAYS        : mRelays   .AddToFile    (aFile_PC6); break;
+        case SectionId::TIMERS        : mTimers   .AddToFile    (aFile_PC6); break;
+        case SectionId::COUNTERS      : mCounters .AddToFile    (aFile_PC6); break;
+        case SectionId::CIRCUITS      : mCircuits .AddToFile    (aFile_PC6); break;
+        case SectionId::FUNCTIONS     : mFunctions.AddCodeToFile(aFile_PC6); break;
+        case SectionId::FUNCTION_NAMES: mFunctions.AddToFile    (aFile_PC6); break;
+        case SectionId::QUICK_TAGS    : mQuickTags.AddToFile    (aFile_PC6); break;
+        case SectionId::DEFINES       : mDefines  .AddToFile    (aFile_PC6); break;
+        case SectionId::FOOTER        : mFooter   .AddToFile    (aFile_PC6); break;
+
+        default: assert(false);
+        }
+    }
+
+    void Project::ClearDirty()
+    {
+        mCircuits .ClearDirty();
+        mCounters .ClearDirty();
+        mDefines  .ClearDirty();
+        mFooter   .ClearDirty();
+        mFunctions.ClearDirty();
+        mInputs   .ClearDirty();
+        mOutputs  .ClearDirty();
+        mQuickTags.ClearDirty();
+        mRelays   .ClearDirty();
+        mTimers   .ClearDirty();
+    }
+
+    // The line lists refer to the buffer the file releases, so they are
+    // parsed again from the copied lines.
+    void Project::Compact()
+    {
+        assert(mSections.IsValid());
+
         mFile.Clear();
 
-        mFile.AddLine(PC6_FILE_HEADER);
+        for (unsigned int i = 0; i < static_cast<unsigned int>(SectionId::QTY); i++)
+        {
+            auto lId    = static_cast<SectionId>(i);
+            auto lFirst = mFile.GetLineCount();
+
+            if (IsLineSection(lId))
+            {
+                mFile.AddLines_Previous(mSections.GetFirst(lId), mSections.GetEnd(lId));
+            }
 
-        mInputs   .AddToFile    (&mFile); mFile.AddLine(PC6_SECTION_END);
-        mOutputs  .AddToFile    (&mFile); mFile.AddLine(PC6_SECTION_END);
-        mRelays   .AddToFile    (&mFile); mFile.AddLine(PC6_SECTION_END);
-        mTimers   .AddToFile    (&mFile); mFile.AddLine(PC6_SECTION_END);
-        mCounters .AddToFile    (&mFile); mFile.AddLine(PC6_SECTION_END);
-        mCircuits .AddToFile    (&mFile); mFile.AddLine(PC6_SECTION_END_CIRCUIT);
-        mFunctions.AddCodeToFile(&mFile); mFile.AddLine(PC6_SECTION_END_CUSTFN);
-        mFunctions.AddToFile    (&mFile); mFile.AddLine(PC6_SECTION_END_CUSTFNLABEL);
-        mQuickTags.AddToFile    (&mFile); mFile.AddLine(PC6_SECTION_END_QUICKTAGS);
-        mDefines  .AddToFile    (&mFile); mFile.AddLine(PC6_SECTION_END_DEFINES);
-        mFooter   .AddToFile    (&mFile);
+            mSections.Set(lId, lFirst, mFile.GetLineCount());
+        }
+
+        mFile.Compact();
+
+        Parse_LineLists();
+
+        mCompacted = true;
     }
 
     void Project::Create()
@@ -484,35 +915,290 @@ namespace TRiLOGI
         auto lFileName = mHeaderFile.Get();
         assert(nullptr != lFileName);
 
+        bool lChanged;
+
         ::Console::Progress_Begin("TRiLOGY", "Export", lFileName);
         {
-            std::ofstream lFile(lFileName);
-            if (!lFile.is_open())
-            {
-                char lMsg[64 + PATH_LENGTH];
-                sprintf_s(lMsg, "Cannot open \"%s\" for writing", lFileName);
-                KMS_EXCEPTION(RESULT_OPEN_FAILED, lMsg, "");
-            }
+            std::ostringstream lText;
 
-            lFile << "\n";
-            lFile << "// File  " << lFileName << "\n";
-            lFile << "\n";
-            lFile << "// Generated by KMS-PLC.exe version " << VERSION;
-            lFile << "\n";
-            lFile << "#pragma once\n";
-            lFile << "\n";
+            lText << "\n";
+            lText << "// File  " << lFileName << "\n";
+            lText << "\n";
+            lText << "// Generated by KMS-PLC.exe version " << VERSION;
+            lText << "\n";
+            lText << "#pragma once\n";
+            lText << "\n";
 
             auto lPrefix = mHeaderPrefix.Get();
             assert(nullptr != lPrefix);
 
+            switch (mHeaderType)
+            {
+            case HeaderType::CONSTEXPR: Export_HeaderFile_Constexpr(lText, lPrefix); break;
+
+            case HeaderType::DEFINE:
+                for (const auto& lAddr : mPublicAddresses)
+                {
+                    lText << "#define " << lPrefix << lAddr.GetName() << " (" << lAddr.GetAddress() << ")\n";
+                }
+                break;
+
+            default: assert(false);
+            }
+
+            lChanged = WriteText(lFileName, lText.str());
+        }
+        ::Console::Progress_End(lChanged ? "Exported" : "Exported (No change)");
+    }
+
+    // The generated code is C++14. Each address has a type, so the compiler
+    // detects a coil used as a holding register. The table is ordered using
+    // a minimal perfect hash, <Prefix>Find looks up a name, at compile time
+    // or at run time, using two hashes and one comparison.
+    //
+    // Without prefix, the declarations are in the PLC namespace, so the
+    // header does not declare global names like Type or Find.
+    void Project::Export_HeaderFile_Constexpr(std::ostream& aOut, const char* aPrefix) const
+    {
+        assert(nullptr != aPrefix);
+
+        auto lNamespace = '\0' == *aPrefix;
+
+        std::vector<const Address*> lAddrs;
+        std::vector<const char*>    lNames;
+
+        for (const auto& lAddr : mPublicAddresses)
+        {
+            lAddrs.push_back(&lAddr);
+            lNames.push_back(lAddr.GetName());
+        }
+
+        PerfectHash lHash;
+
+        lHash.Build(lNames);
+
+        const auto& lSeeds = lHash.GetSeeds();
+        const auto& lSlots = lHash.GetSlots();
+
+        aOut << "#include <stdint.h>\n";
+        aOut << "\n";
+
+        if (lNamespace)
+        {
+            aOut << "namespace PLC\n";
+            aOut << "{\n";
+            aOut << "\n";
+        }
+
+        aOut << "enum class " << aPrefix << "Type : uint8_t\n";
+        aOut << "{\n";
+        aOut << "    COIL,             // Modbus 1x\n";
+        aOut << "    HOLDING_REGISTER, // Modbus 4x\n";
+        aOut << "};\n";
+        aOut << "\n";
+        aOut << "struct " << aPrefix << "Coil            { uint16_t mAddress; };\n";
+        aOut << "struct " << aPrefix << "HoldingRegister { uint16_t mAddress; };\n";
+        aOut << "\n";
+        aOut << "struct " << aPrefix << "Address\n";
+        aOut << "{\n";
+        aOut << "    const char* mName;\n";
+        aOut << "    " << aPrefix << "Type mType;\n";
+        aOut << "    uint16_t mAddress;\n";
+        aOut << "};\n";
+        aOut << "\n";
+
+        for (auto lAddr : lAddrs)
+        {
+            switch (lAddr->GetType())
+            {
+            case AddressType::MODBUS_RTU_1X: aOut << "constexpr " << aPrefix << "Coil "            << aPrefix << lAddr->GetName() << " = { " << lAddr->GetAddress() << " };\n"; break;
+            case AddressType::MODBUS_RTU_4X: aOut << "constexpr " << aPrefix << "HoldingRegister " << aPrefix << lAddr->GetName() << " = { " << lAddr->GetAddress() << " };\n"; break;
+
+            default: assert(false);
+            }
+        }
+
+        aOut << "\n";
+        aOut << "// The empty slots have no name\n";
+        aOut << "constexpr " << aPrefix << "Address " << aPrefix << "ADDRESSES[" << lSlots.size() << "] =\n";
+        aOut << "{\n";
+
+        for (auto lSlot : lSlots)
+        {
+            if (PerfectHash::NO_NAME == lSlot)
+            {
+                aOut << "    { nullptr, " << aPrefix << "Type::COIL, 0 },\n";
+            }
+            else
+            {
+                auto lAddr = lAddrs[lSlot];
+
+                aOut << "    { \"" << lAddr->GetName() << "\", " << aPrefix << "Type::"
+                     << ((AddressType::MODBUS_RTU_1X == lAddr->GetType()) ? "COIL" : "HOLDING_REGISTER")
+                     << ", " << lAddr->GetAddress() << " },\n";
+            }
+        }
+
+        aOut << "};\n";
+        aOut << "\n";
+        aOut << "constexpr uint32_t " << aPrefix << "SEEDS[" << lSeeds.size() << "] =\n";
+        aOut << "{\n";
+
+        for (auto lSeed : lSeeds)
+        {
+            aOut << "    " << lSeed << ",\n";
+        }
+
+        aOut << "};\n";
+        aOut << "\n";
+        aOut << "// 32 bits FNV-1a, the seed modifies the offset basis\n";
+        aOut << "constexpr uint32_t " << aPrefix << "Hash(const char* aName, uint32_t aSeed)\n";
+        aOut << "{\n";
+        aOut << "    uint32_t lResult = 0x811c9dc5 ^ aSeed;\n";
+        aOut << "\n";
+        aOut << "    for (; '\\0' != *aName; aName++)\n";
+        aOut << "    {\n";
+        aOut << "        lResult ^= static_cast<uint8_t>(*aName);\n";
+        aOut << "        lResult *= 0x01000193;\n";
+        aOut << "    }\n";
+        aOut << "\n";
+        aOut << "    return lResult;\n";
+        aOut << "}\n";
+        aOut << "\n";
+        aOut << "// Return  nullptr when no address has this name\n";
+        aOut << "constexpr const " << aPrefix << "Address* " << aPrefix << "Find(const char* aName)\n";
+        aOut << "{\n";
+        aOut << "    const " << aPrefix << "Address* lResult = " << aPrefix << "ADDRESSES\n";
+        aOut << "        + " << aPrefix << "Hash(aName, " << aPrefix << "SEEDS[" << aPrefix << "Hash(aName, 0) % " << lSeeds.size() << "]) % " << lSlots.size() << ";\n";
+        aOut << "\n";
+        aOut << "    if (nullptr == lResult->mName)\n";
+        aOut << "    {\n";
+        aOut << "        return nullptr;\n";
+        aOut << "    }\n";
+        aOut << "\n";
+        aOut << "    for (auto lA = lResult->mName; *lA == *aName; lA++, aName++)\n";
+        aOut << "    {\n";
+        aOut << "        if ('\\0' == *lA)\n";
+        aOut << "        {\n";
+        aOut << "            return lResult;\n";
+        aOut << "        }\n";
+        aOut << "    }\n";
+        aOut << "\n";
+        aOut << "    return nullptr;\n";
+        aOut << "}\n";
+
+        if (lNamespace)
+        {
+            aOut << "\n";
+            aOut << "}\n";
+        }
+    }
+
+    void Project::Export_SymbolFile()
+    {
+        auto lFileName = mSymbolFile.Get();
+        assert(nullptr != lFileName);
+
+        bool lChanged;
+
+        ::Console::Progress_Begin("TRiLOGY", "Export", lFileName);
+        {
+            // The records of a type are contiguous and sorted by address
+            std::vector<const Address*> lAddrs;
+
             for (const auto& lAddr : mPublicAddresses)
             {
-                lFile << "#define " << lPrefix << lAddr.GetName() << " (" << lAddr.GetAddress() << ")\n";
+                lAddrs.push_back(&lAddr);
+            }
+
+            std::stable_sort(lAddrs.begin(), lAddrs.end(), [](const Address* aA, const Address* aB)
+                {
+                    return (aA->GetType() != aB->GetType()) ? (aA->GetType() < aB->GetType()) : (aA->GetAddress() < aB->GetAddress());
+                });
+
+            auto lCount = static_cast<unsigned int>(lAddrs.size());
+
+            std::vector<const char*> lNames;
+            std::vector<SymbolFile_Record> lRecords(lCount);
+            std::string lStrings;
+
+            SymbolFile_Header lHeader;
+
+            memset(&lHeader, 0, sizeof(lHeader));
+            memset(lRecords.data(), 0, sizeof(SymbolFile_Record) * lCount);
+
+            for (unsigned int i = 0; i < lCount; i++)
+            {
+                auto lAddr = lAddrs[i];
+                auto lName = lAddr->GetName();
+
+                SymbolFile_Type lType;
+
+                switch (lAddr->GetType())
+                {
+                case AddressType::MODBUS_RTU_1X: lType = SYMBOL_FILE_TYPE_COIL            ; break;
+                case AddressType::MODBUS_RTU_4X: lType = SYMBOL_FILE_TYPE_HOLDING_REGISTER; break;
+
+                default: assert(false); lType = SYMBOL_FILE_TYPE_QTY;
+                }
+
+                if (0 == lHeader.mTypes[lType].mCount)
+                {
+                    lHeader.mTypes[lType].mFirst = i;
+                }
+
+                lHeader.mTypes[lType].mCount++;
+
+                lRecords[i].mAddress         = static_cast<uint16_t>(lAddr->GetAddress());
+                lRecords[i].mNameLength      = static_cast<uint16_t>(strlen(lName));
+                lRecords[i].mNameOffset_byte = static_cast<uint32_t>(lStrings.size());
+                lRecords[i].mType            = static_cast<uint8_t>(lType);
+
+                lNames.push_back(lName);
+
+                lStrings.append(lName, lRecords[i].mNameLength + 1);
+            }
+
+            PerfectHash lHash;
+
+            lHash.Build(lNames);
+
+            const auto& lSeeds = lHash.GetSeeds();
+            const auto& lSlots = lHash.GetSlots();
+
+            lHeader.mMagic           = SYMBOL_FILE_MAGIC;
+            lHeader.mVersion         = SYMBOL_FILE_VERSION;
+            lHeader.mHeaderSize_byte = sizeof(lHeader);
+
+            lHeader.mRecordCount       = lCount;
+            lHeader.mRecordOffset_byte = sizeof(lHeader);
+            lHeader.mBucketCount       = static_cast<uint32_t>(lSeeds.size());
+            lHeader.mSeedOffset_byte   = lHeader.mRecordOffset_byte + sizeof(SymbolFile_Record) * lCount;
+            lHeader.mSlotCount         = static_cast<uint32_t>(lSlots.size());
+            lHeader.mSlotOffset_byte   = lHeader.mSeedOffset_byte + sizeof(uint32_t) * lHeader.mBucketCount;
+            lHeader.mStringOffset_byte = lHeader.mSlotOffset_byte + sizeof(uint32_t) * lHeader.mSlotCount;
+            lHeader.mStringSize_byte   = static_cast<uint32_t>(lStrings.size());
+
+            std::vector<uint8_t> lData(lHeader.mStringOffset_byte + lHeader.mStringSize_byte);
+
+            memcpy(lData.data(), &lHeader, sizeof(lHeader));
+            memcpy(lData.data() + lHeader.mRecordOffset_byte, lRecords.data(), sizeof(SymbolFile_Record) * lCount);
+            memcpy(lData.data() + lHeader.mSeedOffset_byte  , lSeeds  .data(), sizeof(uint32_t) * lHeader.mBucketCount);
+
+            for (unsigned int i = 0; i < lHeader.mSlotCount; i++)
+            {
+                auto lSlot = (PerfectHash::NO_NAME == lSlots[i]) ? SYMBOL_FILE_NO_RECORD : static_cast<uint32_t>(lSlots[i]);
+
+                memcpy(lData.data() + lHeader.mSlotOffset_byte + sizeof(uint32_t) * i, &lSlot, sizeof(lSlot));
             }
 
-            lFile.close();
+            memcpy(lData.data() + lHeader.mStringOffset_byte, lStrings.data(), lStrings.size());
+
+            DepFile::AddOutput(lFileName);
+
+            lChanged = Utl_WriteIfChanged(File::Folder::CURRENT, lFileName, lData);
         }
-        ::Console::Progress_End("Exported");
+        ::Console::Progress_End(lChanged ? "Exported" : "Exported (No change)");
     }
 
     void Project::Export_ToolConfig()
@@ -520,21 +1206,17 @@ namespace TRiLOGI
         auto lFileName = mToolConfig.Get();
         assert(nullptr != lFileName);
 
+        bool lChanged;
+
         ::Console::Progress_Begin("TRiLOGY", "Export", lFileName);
         {
-            std::ofstream lFile(lFileName);
-            if (!lFile.is_open())
-            {
-                char lMsg[64 + PATH_LENGTH];
-                sprintf_s(lMsg, "Cannot open \"%s\" for writing", lFileName);
-                KMS_EXCEPTION(RESULT_OPEN_FAILED, lMsg, "");
-            }
+            std::ostringstream lText;
 
-            lFile << "\n";
-            lFile << "# File  " << lFileName << "\n";
-            lFile << "\n";
-            lFile << "# Generated by KMS-PLC.exe version " << VERSION;
-            lFile << "\n";
+            lText << "\n";
+            lText << "# File  " << lFileName << "\n";
+            lText << "\n";
+            lText << "# Generated by KMS-PLC.exe version " << VERSION;
+            lText << "\n";
 
             for (const auto& lAddr : mPublicAddresses)
             {
@@ -543,156 +1225,258 @@ namespace TRiLOGI
 
                 switch (lAddr.GetType())
                 {
-                case AddressType::MODBUS_RTU_1X: lFile << "Coils."            << lN << " = " << lA << "\n"; break;
-                case AddressType::MODBUS_RTU_4X: lFile << "HoldingRegisters." << lN << " = " << lA << "\n"; break;
+                case AddressType::MODBUS_RTU_1X: lText << "Coils."            << lN << " = " << lA << "\n"; break;
+                case AddressType::MODBUS_RTU_4X: lText << "HoldingRegisters." << lN << " = " << lA << "\n"; break;
                 }
             }
 
-            lFile.close();
+            lChanged = WriteText(lFileName, lText.str());
         }
-        ::Console::Progress_End("Exported");
+        ::Console::Progress_End(lChanged ? "Exported" : "Exported (No change)");
     }
 
-    bool Project::Import_Source(const char* aFileName)
+    bool Project::Import_Source(const char* aFileName, Optimizer* aOptimizer)
     {
         auto lResult = false;
 
-        Text::File_ASCII lFile;
-
-        lFile.Read(File::Folder::CURRENT, aFileName);
+        DepFile::AddInput(aFileName);
 
-        lFile.RemoveEmptyLines();
-        lFile.RemoveComments_Script();
+        Lexer lLexer(aFileName);
 
-        for (auto lIt = lFile.mLines.begin(); lIt != lFile.mLines.end(); lIt++)
+        while (lLexer.GetNextStatement())
         {
-            unsigned int lIndex;
-            unsigned int lInit;
-            unsigned int lOffset;
-            char lN[NAME_LENGTH];
-            char lValue[LINE_LENGTH];
-
             // TODO Import Constant and Word comment or at least put the source file name in the
             //      comment of newly created ones.
 
-            auto lL = lIt->c_str();
+            auto lArgCount = lLexer.GetArgCount();
 
-            if (1 == sscanf_s(lL, PC6_IN0_ADDRESSES " " PC6_IN0_STRING, lN SizeInfo(lN)))
-            {
-                AddPublicAddresses(lN);
-            }
-            else if (2 == sscanf_s(lL, PC6_IN0_ADDRESS " " PC6_IN0_NAME " " PC6_IN0_NAME, lN SizeInfo(lN), lValue SizeInfo(lValue)))
-            {
-                AddPublicAddress(lN, lValue);
-            }
-            else if (1 == sscanf_s(lL, PC6_IN0_ADDRESS " " PC6_IN0_NAME, lN SizeInfo(lN)))
-            {
-                AddPublicAddress(lN, lN);
-            }
-            else if (2 == sscanf_s(lL, PC6_IN0_CONSTANT " " PC6_IN0_NAME " " PC6_IN0_STRING, lN SizeInfo(lN), lValue SizeInfo(lValue)))
+            switch (lLexer.GetKeyword())
             {
-                lResult |= mDefines.ImportConstant(lN, lValue);
-            }
-            else if (2 == sscanf_s(lL, PC6_IN0_COUNTER " " PC6_IN0_NAME " " PC6_IN0_UINT, lN SizeInfo(lN), &lInit))
-            {
-                lResult |= mCounters.Import(lN, lInit);
-            }
-            else if (1 == sscanf_s(lL, PC6_IN0_FUNCTION " " PC6_IN0_NAME, lN SizeInfo(lN)))
-            {
-                lResult |= mFunctions.Import(lN, &lFile, &lIt);
-            }
-            else if (2 == sscanf_s(lL, PC6_IN0_INPUT " " PC6_IN0_NAME " " PC6_IN0_UINT, lN SizeInfo(lN), &lIndex))
-            {
-                lResult |= mInputs.Import(lN, lIndex);
-            }
-            else if (2 == sscanf_s(lL, PC6_IN0_OUTPUT " " PC6_IN0_NAME " " PC6_IN0_UINT, lN SizeInfo(lN), &lIndex))
-            {
-                lResult |= mOutputs.Import(lN, lIndex);
-            }
-            else if (2 == sscanf_s(lL, PC6_IN0_RELAY " " PC6_IN0_NAME " " PC6_IN0_UINT, lN SizeInfo(lN), &lIndex))
-            {
-                lResult |= mRelays.Import(lN, lIndex);
-            }
-            else if (1 == sscanf_s(lL, PC6_IN0_RELAY " " PC6_IN0_NAME, lN SizeInfo(lN)))
-            {
-                lResult |= mRelays.Import(lN);
-            }
-            else if (2 == sscanf_s(lL, PC6_IN0_TIMER " " PC6_IN0_NAME " " PC6_IN0_UINT, lN SizeInfo(lN), &lInit))
-            {
-                lResult |= mTimers.Import(lN, lInit);
-            }
-            else if (2 == sscanf_s(lL, PC6_IN0_WORD " " PC6_IN0_NAME " " PC6_IN0_UINT, lN SizeInfo(lN), &lOffset))
-            {
-                lResult |= mDefines.ImportWord(lN, lOffset);
-            }
-            else if (1 == sscanf_s(lL, PC6_IN0_WORD " " PC6_IN0_NAME, lN SizeInfo(lN)))
-            {
-                lResult |= mDefines.ImportWord(lN);
-            }
-            else
-            {
-                ::Console::Warning_IgnoredLine(lIt->GetUserLineNo(), lL);
+            case Keyword::ADDRESS  : mAddressStatements.push_back({ lLexer.GetArg(0), lLexer.GetArg((1 < lArgCount) ? 1 : 0), 0 }); break;
+            case Keyword::ADDRESSES: mAddressStatements.push_back({ "", lLexer.GetArg(0), mPatterns.Add(lLexer.GetArg(0)) }); break;
+
+            case Keyword::CONSTANT: lResult |= mDefines  .ImportConstant(lLexer.GetArg(0), lLexer.GetArg     (1)); break;
+            case Keyword::COUNTER : lResult |= mCounters .Import        (lLexer.GetArg(0), lLexer.GetArg_UInt(1)); break;
+            case Keyword::FUNCTION: lResult |= mFunctions.Import        (lLexer.GetArg(0), lLexer.GetParser  ( ), aOptimizer); break;
+            case Keyword::INPUT   : lResult |= mInputs   .Import        (lLexer.GetArg(0), lLexer.GetArg_UInt(1)); break;
+            case Keyword::OUTPUT  : lResult |= mOutputs  .Import        (lLexer.GetArg(0), lLexer.GetArg_UInt(1)); break;
+            case Keyword::TIMER   : lResult |= mTimers   .Import        (lLexer.GetArg(0), lLexer.GetArg_UInt(1)); break;
+
+            case Keyword::RELAY:
+                lResult |= (1 < lArgCount) ? mRelays.Import(lLexer.GetArg(0), lLexer.GetArg_UInt(1)) : mRelays.Import(lLexer.GetArg(0));
+                break;
+
+            case Keyword::WORD:
+                lResult |= (1 < lArgCount) ? mDefines.ImportWord(lLexer.GetArg(0), lLexer.GetArg_UInt(1)) : mDefines.ImportWord(lLexer.GetArg(0));
+                break;
+
+            case Keyword::INVALID: ::Console::Warning_IgnoredLine(lLexer.GetLineNo(), lLexer.GetLine()); break;
+
+            default: assert(false);
             }
         }
 
         return lResult;
     }
 
+    // The section index makes the sections independent, so each list parses
+    // its own section in a worker thread. The tasks are waited for in the
+    // file order, so the exception of the first bad section propagates and
+    // the statistics are displayed in the same order as before.
     void Project::Parse_Legacy()
     {
-        unsigned int lLineNo = 1;
+        if (!mSnapshot.empty())
+        {
+            ReadSnapshot_Lists();
+
+            // The lists of lines only refer to the lines of the file
+            mCircuits .Parse(mFile, mSections.GetFirst(SectionId::CIRCUITS  ), mSections.GetEnd(SectionId::CIRCUITS  ));
+            mQuickTags.Parse(mFile, mSections.GetFirst(SectionId::QUICK_TAGS), mSections.GetEnd(SectionId::QUICK_TAGS));
+            mFooter   .Parse(mFile, mSections.GetFirst(SectionId::FOOTER    ), mSections.GetEnd(SectionId::FOOTER    ));
+        }
+        else
+        {
+            Parse_Legacy_Full();
+
+            WriteSnapshot();
+        }
+
+        ClearDirty();
+
+        if (mCompact)
+        {
+            Compact();
+        }
+
+        mInputs   .DisplayStats();
+        mOutputs  .DisplayStats();
+        mRelays   .DisplayStats();
+        mTimers   .DisplayStats();
+        mCounters .DisplayStats();
+        mFunctions.DisplayStats();
+        mDefines  .DisplayStats();
+    }
+
+    void Project::Parse_Legacy_Full()
+    {
+        mSections.Build(mFile);
+
+        // The lists do not share a base class with a Parse method, so the
+        // lambda is generic.
+        auto lBits = [this](auto* aList, SectionId aId, unsigned int aFlags)
+        {
+            return std::async(std::launch::async, [this, aList, aId, aFlags]()
+                {
+                    aList->Parse(mFile, mSections.GetFirst(aId), mSections.GetEnd(aId), aFlags);
+                });
+        };
+
+        auto lLines = [this](LineList* aList, SectionId aId)
+        {
+            return std::async(std::launch::async, [this, aList, aId]()
+                {
+                    aList->Parse(mFile, mSections.GetFirst(aId), mSections.GetEnd(aId));
+                });
+        };
+
+        mSymbols.BeginParallel();
+
+        std::future<void> lTasks[] =
+        {
+            lBits(&mInputs  , SectionId::INPUTS  , TRiLOGI::Object::FLAG_SINGLE_USE_INFO),
+            lBits(&mOutputs , SectionId::OUTPUTS , TRiLOGI::Object::FLAG_SINGLE_USE_INFO),
+            lBits(&mRelays  , SectionId::RELAYS  , TRiLOGI::Object::FLAG_SINGLE_USE_INFO),
+            lBits(&mTimers  , SectionId::TIMERS  , TRiLOGI::Object::FLAG_SINGLE_USE_WARNING),
+            lBits(&mCounters, SectionId::COUNTERS, TRiLOGI::Object::FLAG_SINGLE_USE_WARNING),
+
+            lLines(&mCircuits, SectionId::CIRCUITS),
+
+            // The function names refer to the functions the code section
+            // creates, so both sections are parsed by the same task.
+            std::async(std::launch::async, [this]()
+                {
+                    mFunctions.Parse_Code(mFile, mSections.GetFirst(SectionId::FUNCTIONS     ), mSections.GetEnd(SectionId::FUNCTIONS     ));
+                    mFunctions.Parse_Name(mFile, mSections.GetFirst(SectionId::FUNCTION_NAMES), mSections.GetEnd(SectionId::FUNCTION_NAMES));
+                }),
+
+            lLines(&mQuickTags, SectionId::QUICK_TAGS),
+
+            std::async(std::launch::async, [this]()
+                {
+                    mDefines.Parse(mFile, mSections.GetFirst(SectionId::DEFINES), mSections.GetEnd(SectionId::DEFINES));
+                }),
+
+            lLines(&mFooter, SectionId::FOOTER),
+        };
 
-        lLineNo = mInputs   .Parse(&mFile, lLineNo, TRiLOGI::Object::FLAG_SINGLE_USE_INFO);
-        lLineNo = mOutputs  .Parse(&mFile, lLineNo, TRiLOGI::Object::FLAG_SINGLE_USE_INFO);
-        lLineNo = mRelays   .Parse(&mFile, lLineNo, TRiLOGI::Object::FLAG_SINGLE_USE_INFO);
-        lLineNo = mTimers   .Parse(&mFile, lLineNo, TRiLOGI::Object::FLAG_SINGLE_USE_WARNING);
-        lLineNo = mCounters .Parse(&mFile, lLineNo, TRiLOGI::Object::FLAG_SINGLE_USE_WARNING);
-        lLineNo = mCircuits .Parse(&mFile, lLineNo, false);
-        lLineNo = mFunctions.Parse_Code(&mFile, lLineNo);
-        lLineNo = mFunctions.Parse_Name(&mFile, lLineNo);
-        lLineNo = mQuickTags.Parse(&mFile, lLineNo, false);
-        lLineNo = mDefines  .Parse(&mFile, lLineNo);
-        lLineNo = mFooter   .Parse(&mFile, lLineNo, true);
+        // All the tasks end before the table stops locking, even when one
+        // of them fails.
+        for (auto& lTask : lTasks)
+        {
+            lTask.wait();
+        }
+
+        mSymbols.EndParallel();
+
+        for (auto& lTask : lTasks)
+        {
+            lTask.get();
+        }
+    }
+
+    // Without the buffer Read decoded, the lines of the file are in the
+    // arena of the current content. The next Clear keeps it, but the one
+    // after resets it, so the line lists must refer to the lines of each
+    // new content.
+    void Project::Parse_LineLists()
+    {
+        auto lLines = [this](LineList* aList, SectionId aId)
+        {
+            aList->ClearList();
+            aList->Parse(mFile, mSections.GetFirst(aId), mSections.GetEnd(aId));
+            aList->ClearDirty();
+        };
+
+        lLines(&mCircuits , SectionId::CIRCUITS);
+        lLines(&mQuickTags, SectionId::QUICK_TAGS);
+        lLines(&mFooter   , SectionId::FOOTER);
     }
 
     void Project::Parse_New()
     {
-        unsigned int lLineNo = 1;
+        mSections.Build(mFile);
 
-        lLineNo = ParseNothing(lLineNo, 5); // Inputs, Outputs, Relays, Timers, Counters
-        lLineNo = mCircuits.Parse(&mFile, lLineNo, false);
-        lLineNo = ParseNothing(lLineNo, 2); // Functions, Function names
-        lLineNo = mQuickTags.Parse(&mFile, lLineNo, false);
-        lLineNo = ParseNothing(lLineNo, 1); // Defines
-        lLineNo = mFooter.Parse(&mFile, lLineNo, true);
+        mCircuits .Parse(mFile, mSections.GetFirst(SectionId::CIRCUITS  ), mSections.GetEnd(SectionId::CIRCUITS  ));
+        mQuickTags.Parse(mFile, mSections.GetFirst(SectionId::QUICK_TAGS), mSections.GetEnd(SectionId::QUICK_TAGS));
+        mFooter   .Parse(mFile, mSections.GetFirst(SectionId::FOOTER    ), mSections.GetEnd(SectionId::FOOTER    ));
+
+        // The other lists come only from the sources, they stay dirty
+        mCircuits .ClearDirty();
+        mFooter   .ClearDirty();
+        mQuickTags.ClearDirty();
     }
 
-    unsigned int Project::ParseNothing(unsigned int aLineNo, unsigned int aSectionCount)
+    // The file is mapped to compute the key, but it is decoded only when
+    // the snapshot does not correspond to it.
+    bool Project::ReadSnapshot()
     {
-        assert(0 < aLineNo);
-        assert(0 < aSectionCount);
+        mSnapshot.clear();
+
+        if ((0 >= mSnapshotFile.GetLength()) || (ProjectType::LEGACY != mProjectType))
+        {
+            return false;
+        }
 
-        auto lLineCount    = mFile.GetLineCount();
-        auto lLineNo       = aLineNo;
-        auto lSectionCount = aSectionCount;
+        unsigned int lSize_byte;
 
-        for (; lLineNo < lLineCount; lLineNo++)
+        uint64_t lKey[2];
+
+        lKey[0] = File_PC6::ReadHash(File::Folder::CURRENT, mFileName.Get(), &lSize_byte);
+        lKey[1] = lSize_byte;
+
+        if (!Snapshot_Read(File::Folder::CURRENT, mSnapshotFile.Get(), lKey, 2, &mSnapshot))
         {
-            const wchar_t* lLine = mFile.GetLine(lLineNo);
+            return false;
+        }
 
-            if (PC6_SECTION_END_C == lLine[0])
-            {
-                if (1 >= lSectionCount)
-                {
-                    lLineNo++;
-                    break;
-                }
+        SnapshotReader lReader(mSnapshot.data(), static_cast<unsigned int>(mSnapshot.size()));
 
-                lSectionCount--;
-            }
+        mFile.ReadSnapshot(&lReader, lKey[0], lSize_byte);
+
+        mSnapshot_Offset_byte = lReader.GetOffset_byte();
+
+        return true;
+    }
+
+    // The snapshot is used once, Reparse parses the file
+    void Project::ReadSnapshot_Lists()
+    {
+        assert(mSnapshot.size() >= mSnapshot_Offset_byte);
+
+        SnapshotReader lReader(mSnapshot.data() + mSnapshot_Offset_byte, static_cast<unsigned int>(mSnapshot.size() - mSnapshot_Offset_byte));
+
+        for (unsigned int i = 0; i < static_cast<unsigned int>(SectionId::QTY); i++)
+        {
+            auto lFirst = lReader.Get_UInt();
+            auto lEnd   = lReader.Get_UInt();
+
+            KMS_EXCEPTION_ASSERT((lFirst <= lEnd) && (mFile.GetLineCount() >= lEnd), RESULT_INVALID_FORMAT, "Invalid snapshot", mSnapshotFile.Get());
+
+            mSections.Set(static_cast<SectionId>(i), lFirst, lEnd);
         }
 
-        return lLineNo;
+        mInputs   .ReadSnapshot(&lReader, TRiLOGI::Object::FLAG_SINGLE_USE_INFO);
+        mOutputs  .ReadSnapshot(&lReader, TRiLOGI::Object::FLAG_SINGLE_USE_INFO);
+        mRelays   .ReadSnapshot(&lReader, TRiLOGI::Object::FLAG_SINGLE_USE_INFO);
+        mTimers   .ReadSnapshot(&lReader, TRiLOGI::Object::FLAG_SINGLE_USE_WARNING);
+        mCounters .ReadSnapshot(&lReader, TRiLOGI::Object::FLAG_SINGLE_USE_WARNING);
+        mFunctions.ReadSnapshot(&lReader, 0);
+        mDefines  .ReadSnapshot(&lReader, 0);
+
+        KMS_EXCEPTION_ASSERT(lReader.IsAtEnd(), RESULT_INVALID_FORMAT, "Invalid snapshot", mSnapshotFile.Get());
+
+        // The objects do not refer to the snapshot
+        std::vector<uint8_t>().swap(mSnapshot);
     }
 
     // NOT TESTED
@@ -708,6 +1492,8 @@ namespace TRiLOGI
             mOutputs  .ClearList();
             mRelays   .ClearList();
             mTimers   .ClearList();
+
+            mSymbols.Clear();
             break;
 
         case ProjectType::NEW: break;
@@ -722,6 +1508,67 @@ namespace TRiLOGI
         Parse();
     }
 
+    void Project::Verify_Reachability()
+    {
+        Reachability lReachability(mSymbols, &mFunctions);
+
+        lReachability.Analyze(mCircuits);
+
+        unsigned int lCount = 0;
+
+        lCount += mFunctions.Verify_Reachability(lReachability, SymbolKind::FUNCTION, nullptr);
+
+        // Before the import, the public addresses are not known and the
+        // HMI may use any relay or word.
+        if (mImported)
+        {
+            lCount += mRelays .Verify_Reachability(lReachability, SymbolKind::RELAY, &mPublicAddresses);
+            lCount += mDefines.Verify_Reachability(lReachability, SymbolKind::WORD , &mPublicAddresses);
+        }
+
+        if (0 < lCount)
+        {
+            ::Console::Warning_Begin()
+                << lCount << " functions, relays or words not reachable";
+            ::Console::Warning_End();
+        }
+    }
+
+    void Project::WriteSnapshot() const
+    {
+        if (0 >= mSnapshotFile.GetLength())
+        {
+            return;
+        }
+
+        std::vector<uint8_t> lData;
+
+        SnapshotWriter lWriter(&lData);
+
+        mFile.WriteSnapshot(&lWriter);
+
+        for (unsigned int i = 0; i < static_cast<unsigned int>(SectionId::QTY); i++)
+        {
+            lWriter.Add_UInt(mSections.GetFirst(static_cast<SectionId>(i)));
+            lWriter.Add_UInt(mSections.GetEnd  (static_cast<SectionId>(i)));
+        }
+
+        mInputs   .WriteSnapshot(&lWriter);
+        mOutputs  .WriteSnapshot(&lWriter);
+        mRelays   .WriteSnapshot(&lWriter);
+        mTimers   .WriteSnapshot(&lWriter);
+        mCounters .WriteSnapshot(&lWriter);
+        mFunctions.WriteSnapshot(&lWriter);
+        mDefines  .WriteSnapshot(&lWriter);
+
+        uint64_t lKey[2];
+
+        lKey[0] = mFile.GetHash();
+        lKey[1] = mFile.GetSize_byte();
+
+        Snapshot_Write(File::Folder::CURRENT, mSnapshotFile.Get(), lKey, 2, lData);
+    }
+
     // ===== Callbacks ======================================================
 
     unsigned int Project::OnProjectTypeChanged(void*, void*)
@@ -752,3 +1599,42 @@ void Instruction_Write()
     }
     lHS.End();
 }
+
+// The line lists refer to the lines of the file, the other sections are
+// formatted from the objects.
+bool IsLineSection(TRiLOGI::SectionId aId)
+{
+    switch (aId)
+    {
+    case TRiLOGI::SectionId::CIRCUITS  :
+    case TRiLOGI::SectionId::FOOTER    :
+    case TRiLOGI::SectionId::QUICK_TAGS: return true;
+
+    default: return false;
+    }
+}
+
+// The text uses the end of line of Windows, as the text mode stream
+// previously writing the file did.
+bool WriteText(const char* aFileName, const std::string& aText)
+{
+    assert(nullptr != aFileName);
+
+    DepFile::AddOutput(aFileName);
+
+    std::vector<uint8_t> lData;
+
+    lData.reserve(aText.size() * 2);
+
+    for (auto lC : aText)
+    {
+        if ('\n' == lC)
+        {
+            lData.push_back('\r');
+        }
+
+        lData.push_back(static_cast<uint8_t>(lC));
+    }
+
+    return Utl_WriteIfChanged(File::Folder::CURRENT, aFileName, lData);
+}
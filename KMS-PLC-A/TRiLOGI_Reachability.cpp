@@ -0,0 +1,364 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI_Reachability.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/TRiLOGI/FunctionList.h"
+#include "../Common/TRiLOGI/LineList.h"
+
+#include "TRiLOGI/Function.h"
+#include "TRiLOGI/Reachability.h"
+
+using namespace KMS;
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define NO_ARG (0xffffffff)
+
+// The statements installing a function using its number and the index of
+// this argument. CALL 2, HSCDEF ch, 2, value and INTRDEF ch, 2, edge.
+typedef struct
+{
+    const char * mName;
+    unsigned int mArg;
+}
+FunctionArg;
+
+static const FunctionArg FUNCTION_ARGS[] =
+{
+    { "CALL"   , 0 },
+    { "HSCDEF" , 1 },
+    { "INTRDEF", 1 },
+};
+
+#define FUNCTION_ARG_QTY (sizeof(FUNCTION_ARGS) / sizeof(FUNCTION_ARGS[0]))
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static unsigned int GetFunctionArg(const char* aName);
+
+static bool IsNameChar (unsigned int aC);
+static bool IsNameFirst(unsigned int aC);
+
+// Return  The character following the name
+template <typename C>
+static const C* GetName(const C* aIn, char* aOut, unsigned int aOutSize_byte);
+
+namespace TRiLOGI
+{
+
+    // Public
+    // //////////////////////////////////////////////////////////////////////
+
+    Reachability::Reachability(const SymbolTable& aSymbols, FunctionList* aFunctions)
+        : mAllFunctions(false)
+        , mAllRelays(false)
+        , mAllWords(false)
+        , mFunctions(aFunctions)
+        , mSymbols(aSymbols)
+    {
+        assert(nullptr != aFunctions);
+    }
+
+    void Reachability::Analyze(const LineList& aCircuits)
+    {
+        auto lCircuitCount = aCircuits.GetLineCount();
+
+        for (unsigned int i = 0; i < lCircuitCount; i++)
+        {
+            Scan_Circuit(aCircuits.GetLine(i));
+        }
+
+        // Each function enters mToScan once, when it is reached the first
+        // time, so a recursive call does not loop.
+        while (!mToScan.empty())
+        {
+            auto lFunction = mToScan.back();
+
+            mToScan.pop_back();
+
+            auto lLineCount = lFunction->GetLineCount();
+
+            for (unsigned int i = 0; i < lLineCount; i++)
+            {
+                Scan_Code(lFunction->GetLine(i));
+            }
+        }
+    }
+
+    bool Reachability::IsReached(const Object* aObject, SymbolKind aKind) const
+    {
+        assert(nullptr != aObject);
+
+        switch (aKind)
+        {
+        case SymbolKind::RELAY: if (mAllRelays) { return true; } break;
+        case SymbolKind::WORD : if (mAllWords ) { return true; } break;
+
+        default:;
+        }
+
+        return mReached.end() != mReached.find(aObject);
+    }
+
+    // Private
+    // //////////////////////////////////////////////////////////////////////
+
+    // A name may designate one object of each kind, all of them are reached.
+    void Reachability::Reach(const char* aName)
+    {
+        assert(nullptr != aName);
+
+        auto lSymbol = mSymbols.Find(aName);
+        if (nullptr != lSymbol)
+        {
+            for (unsigned int i = 0; i < static_cast<unsigned int>(SymbolKind::QTY); i++)
+            {
+                auto lObject = lSymbol->mObjects[i];
+                if (nullptr != lObject)
+                {
+                    if (SymbolKind::FUNCTION == static_cast<SymbolKind>(i))
+                    {
+                        Reach(static_cast<Function*>(lObject));
+                    }
+                    else
+                    {
+                        mReached.insert(lObject);
+                    }
+                }
+            }
+        }
+    }
+
+    void Reachability::Reach(Function* aFunction)
+    {
+        if ((nullptr != aFunction) && mReached.insert(aFunction).second)
+        {
+            mToScan.push_back(aFunction);
+        }
+    }
+
+    void Reachability::Reach_Function(const char* aArg)
+    {
+        auto lNumber = mFunctions->GetNumber(aArg);
+        if (0 < lNumber)
+        {
+            Reach(mFunctions->Find_ByIndex(lNumber - 1));
+        }
+        else
+        {
+            Reach_AllFunctions();
+        }
+    }
+
+    void Reachability::Reach_AllFunctions()
+    {
+        if (!mAllFunctions)
+        {
+            mAllFunctions = true;
+
+            auto lCount = mFunctions->GetCount();
+
+            for (unsigned int i = 0, lFound = 0; lFound < lCount; i++)
+            {
+                auto lFunction = mFunctions->Find_ByIndex(i);
+                if (nullptr != lFunction)
+                {
+                    Reach(lFunction);
+
+                    lFound++;
+                }
+            }
+        }
+    }
+
+    // The statements FUNCTION_ARGS lists give the function number, which
+    // is the index plus one. An argument neither a number nor a constant,
+    // an expression for example, may designate any function. A comment
+    // starts with ' , // or REM.
+    void Reachability::Scan_Code(const char* aLine)
+    {
+        assert(nullptr != aLine);
+
+        auto lArg = NO_ARG;
+        auto lIn  = aLine;
+
+        while ('\0' != *lIn)
+        {
+            auto lC = static_cast<unsigned char>(*lIn);
+
+            if (IsNameFirst(lC))
+            {
+                auto lBegin = lIn;
+
+                char lName[NAME_LENGTH];
+
+                lIn = GetName(lIn, lName, sizeof(lName));
+
+                auto lFunctionArg = GetFunctionArg(lName);
+
+                if      (NO_ARG != lFunctionArg)       { lArg = lFunctionArg; }
+                else if (0 == _stricmp("REM", lName)) { break; }
+                else
+                {
+                    if ('[' == *lIn)
+                    {
+                        if (0 == _stricmp("DM"   , lName)) { mAllWords  = true; }
+                        if (0 == _stricmp("RELAY", lName)) { mAllRelays = true; }
+                    }
+
+                    Reach(lName);
+
+                    if (0 == lArg)
+                    {
+                        Reach_Function(lBegin);
+
+                        lArg = NO_ARG;
+                    }
+                }
+            }
+            else if (('0' <= lC) && ('9' >= lC))
+            {
+                if (0 == lArg)
+                {
+                    Reach_Function(lIn);
+
+                    lArg = NO_ARG;
+                }
+
+                while (('0' <= *lIn) && ('9' >= *lIn))
+                {
+                    lIn++;
+                }
+            }
+            else if ('"' == lC)
+            {
+                lIn++;
+
+                while (('\0' != *lIn) && ('"' != *lIn))
+                {
+                    lIn++;
+                }
+
+                if ('\0' != *lIn)
+                {
+                    lIn++;
+                }
+            }
+            else if (('\'' == lC) || (('/' == lC) && ('/' == lIn[1])))
+            {
+                break;
+            }
+            else
+            {
+                if (0 == lArg)
+                {
+                    if ((' ' != lC) && ('\t' != lC))
+                    {
+                        Reach_AllFunctions();
+
+                        lArg = NO_ARG;
+                    }
+                }
+                else if ((',' == lC) && (NO_ARG != lArg))
+                {
+                    lArg--;
+                }
+
+                lIn++;
+            }
+        }
+    }
+
+    // The % and the letter preceding the name of a coil give its type, %L
+    // designates a CusFn coil.
+    void Reachability::Scan_Circuit(const wchar_t* aLine)
+    {
+        assert(nullptr != aLine);
+
+        auto lIn = aLine;
+
+        while (L'\0' != *lIn)
+        {
+            if ((L'%' == lIn[0]) && (L'\0' != lIn[1]))
+            {
+                lIn += 2;
+            }
+            else if (IsNameFirst(*lIn))
+            {
+                char lName[NAME_LENGTH];
+
+                lIn = GetName(lIn, lName, sizeof(lName));
+
+                Reach(lName);
+            }
+            else
+            {
+                lIn++;
+            }
+        }
+    }
+
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+unsigned int GetFunctionArg(const char* aName)
+{
+    assert(nullptr != aName);
+
+    for (unsigned int i = 0; i < FUNCTION_ARG_QTY; i++)
+    {
+        if (0 == _stricmp(FUNCTION_ARGS[i].mName, aName))
+        {
+            return FUNCTION_ARGS[i].mArg;
+        }
+    }
+
+    return NO_ARG;
+}
+
+bool IsNameChar(unsigned int aC)
+{
+    return IsNameFirst(aC) || (('0' <= aC) && ('9' >= aC));
+}
+
+bool IsNameFirst(unsigned int aC)
+{
+    return (('A' <= aC) && ('Z' >= aC)) || (('a' <= aC) && ('z' >= aC)) || ('_' == aC);
+}
+
+// A name too long for the buffer is truncated, so it designates no object.
+template <typename C>
+const C* GetName(const C* aIn, char* aOut, unsigned int aOutSize_byte)
+{
+    assert(nullptr != aIn);
+    assert(nullptr != aOut);
+    assert(0 < aOutSize_byte);
+
+    auto lIn = aIn;
+    unsigned int lLength = 0;
+
+    while (IsNameChar(static_cast<unsigned int>(*lIn)))
+    {
+        if (aOutSize_byte - 1 > lLength)
+        {
+            aOut[lLength] = static_cast<char>(*lIn);
+            lLength++;
+        }
+
+        lIn++;
+    }
+
+    aOut[lLength] = '\0';
+
+    return lIn;
+}
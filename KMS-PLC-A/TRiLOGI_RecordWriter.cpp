@@ -0,0 +1,169 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI_RecordWriter.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/TRiLOGI/RecordWriter.h"
+
+using namespace KMS;
+
+KMS_RESULT_STATIC(RESULT_LINE_TOO_LONG);
+
+namespace TRiLOGI
+{
+
+    // Public
+    // //////////////////////////////////////////////////////////////////////
+
+    RecordWriter::RecordWriter(File_PC6* aFile_PC6) : mFile_PC6(aFile_PC6), mBegin(nullptr), mPtr(nullptr)
+    {
+        assert(nullptr != aFile_PC6);
+    }
+
+    void RecordWriter::Begin()
+    {
+        assert(nullptr == mBegin);
+
+        mBegin = mFile_PC6->AddLine_Begin(LINE_LENGTH);
+        mPtr   = mBegin;
+    }
+
+    void RecordWriter::End()
+    {
+        assert(nullptr != mBegin);
+        assert(mBegin + LINE_LENGTH > mPtr);
+
+        *mPtr = L'\0';
+        mPtr++;
+
+        mFile_PC6->AddLine_End(static_cast<unsigned int>(mPtr - mBegin));
+
+        mBegin = nullptr;
+        mPtr   = nullptr;
+    }
+
+    void RecordWriter::Add(wchar_t aC)
+    {
+        Verify(1);
+
+        *mPtr = aC;
+        mPtr++;
+    }
+
+    void RecordWriter::Add(const char* aString)
+    {
+        assert(nullptr != aString);
+
+        auto lLength = static_cast<unsigned int>(strlen(aString));
+
+        Verify(lLength);
+
+        auto lIn = reinterpret_cast<const unsigned char*>(aString);
+
+        for (unsigned int i = 0; i < lLength; i++)
+        {
+            mPtr[i] = lIn[i];
+        }
+
+        mPtr += lLength;
+    }
+
+    void RecordWriter::Add(const wchar_t* aString)
+    {
+        assert(nullptr != aString);
+
+        auto lLength = static_cast<unsigned int>(wcslen(aString));
+
+        Verify(lLength);
+
+        memcpy(mPtr, aString, lLength * sizeof(wchar_t));
+
+        mPtr += lLength;
+    }
+
+    // Like std::to_chars, the digits are counted first and then written
+    // from the last one.
+    void RecordWriter::Add_UInt(unsigned int aValue)
+    {
+        unsigned int lLength = 1;
+
+        for (auto lValue = aValue; 10 <= lValue; lValue /= 10)
+        {
+            lLength++;
+        }
+
+        Verify(lLength);
+
+        auto lValue = aValue;
+
+        for (auto i = lLength; 0 < i; i--)
+        {
+            mPtr[i - 1] = static_cast<wchar_t>(L'0' + lValue % 10);
+
+            lValue /= 10;
+        }
+
+        mPtr += lLength;
+    }
+
+    // A code point outside of the basic multilingual plane becomes a
+    // surrogate pair.
+    void RecordWriter::Add_UTF8(const char* aString)
+    {
+        assert(nullptr != aString);
+
+        auto lIn = reinterpret_cast<const unsigned char*>(aString);
+
+        while ('\0' != *lIn)
+        {
+            unsigned int lCP;
+            unsigned int lCount;
+
+            if      (0x80 > *lIn) { lCP = *lIn       ; lCount = 0; }
+            else if (0xc2 > *lIn) { KMS_EXCEPTION(RESULT_INVALID_FORMAT, "Invalid UTF-8 string", aString); }
+            else if (0xe0 > *lIn) { lCP = *lIn & 0x1f; lCount = 1; }
+            else if (0xf0 > *lIn) { lCP = *lIn & 0x0f; lCount = 2; }
+            else if (0xf5 > *lIn) { lCP = *lIn & 0x07; lCount = 3; }
+            else                  { KMS_EXCEPTION(RESULT_INVALID_FORMAT, "Invalid UTF-8 string", aString); }
+
+            lIn++;
+
+            for (unsigned int i = 0; i < lCount; i++)
+            {
+                KMS_EXCEPTION_ASSERT(0x80 == (*lIn & 0xc0), RESULT_INVALID_FORMAT, "Invalid UTF-8 string", aString);
+
+                lCP = (lCP << 6) | (*lIn & 0x3f);
+                lIn++;
+            }
+
+            if (0x10000 > lCP)
+            {
+                Add(static_cast<wchar_t>(lCP));
+            }
+            else
+            {
+                lCP -= 0x10000;
+
+                Add(static_cast<wchar_t>(0xd800 + (lCP >> 10)));
+                Add(static_cast<wchar_t>(0xdc00 + (lCP & 0x3ff)));
+            }
+        }
+    }
+
+    // Private
+    // //////////////////////////////////////////////////////////////////////
+
+    // One character stays available for the null character.
+    void RecordWriter::Verify(unsigned int aLength)
+    {
+        assert(nullptr != mBegin);
+
+        KMS_EXCEPTION_ASSERT(LINE_LENGTH > (mPtr - mBegin) + aLength, RESULT_LINE_TOO_LONG, "The line is too long", aLength);
+    }
+
+}
@@ -0,0 +1,624 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI_ScanTime.cpp
+
+#include "Component.h"
+
+// ===== C++ ================================================================
+#include <algorithm>
+
+// ===== Import/Includes ====================================================
+#include <KMS/Cfg/MetaData.h>
+
+// ===== Local ==============================================================
+#include "../Common/TRiLOGI/FunctionList.h"
+#include "../Common/TRiLOGI/LineList.h"
+#include "../Common/TRiLOGI/ScanTime.h"
+
+#include "TRiLOGI/Function.h"
+
+using namespace KMS;
+
+// Data type and constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define NO_CYCLE (0xffffffff)
+
+typedef struct
+{
+    const char* mKeyword;
+    uint32_t    mCost_us;
+}
+StatementCost;
+
+// Rough defaults for the statements communicating with a peripheral, the
+// Statements entries replace them.
+static const StatementCost STATEMENT_COSTS[] =
+{
+    { "PRINT"   , 1000 },
+    { "SAVE_EEP", 2000 },
+    { "SETLCD"  ,  500 },
+};
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+static const Cfg::MetaData MD_BUDGET         ("Budget = {us}");
+static const Cfg::MetaData MD_CIRCUIT        ("Circuit = {us}");
+static const Cfg::MetaData MD_COIL           ("Coil = {us}");
+static const Cfg::MetaData MD_CONTACT        ("Contact = {us}");
+static const Cfg::MetaData MD_CUSFN          ("CusFn = {us}");
+static const Cfg::MetaData MD_LOOP_ITERATIONS("LoopIterations = {Count}");
+static const Cfg::MetaData MD_STATEMENT      ("Statement = {us}");
+static const Cfg::MetaData MD_STATEMENTS     ("Statements += {Keyword}:{us}");
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+// Return  The character following the keyword. aOut is empty when the
+//         line contains no statement.
+static const char* GetKeyword(const char* aLine, char* aOut, unsigned int aOutSize_byte);
+
+// FOR Var = First TO Last [STEP Step]
+//
+// Return  false when the bounds are not constant
+static bool GetIterations(const char* aArgs, uint64_t* aOut);
+
+// IF ... THEN without statement following THEN
+static bool IsBlock(const char* aArgs);
+
+static bool IsNameChar(char aC);
+
+static bool ParseStatementCost(const char* aIn, std::string* aKeyword, uint64_t* aCost_us);
+
+static void ToUpper(std::string* aInOut);
+
+namespace TRiLOGI
+{
+
+    // Public
+    // //////////////////////////////////////////////////////////////////////
+
+    const uint32_t ScanTime::BUDGET_DEFAULT          =  0;
+    const uint32_t ScanTime::CIRCUIT_DEFAULT         =  5;
+    const uint32_t ScanTime::COIL_DEFAULT            =  2;
+    const uint32_t ScanTime::CONTACT_DEFAULT         =  1;
+    const uint32_t ScanTime::CUSFN_DEFAULT           = 20;
+    const uint32_t ScanTime::LOOP_ITERATIONS_DEFAULT = 10;
+    const uint32_t ScanTime::STATEMENT_DEFAULT       = 30;
+
+    ScanTime::ScanTime()
+        : mBudget_us     (BUDGET_DEFAULT)
+        , mCircuit_us    (CIRCUIT_DEFAULT)
+        , mCoil_us       (COIL_DEFAULT)
+        , mContact_us    (CONTACT_DEFAULT)
+        , mCusFn_us      (CUSFN_DEFAULT)
+        , mLoopIterations(LOOP_ITERATIONS_DEFAULT)
+        , mStatement_us  (STATEMENT_DEFAULT)
+        , mCycle(NO_CYCLE)
+        , mFunctions(nullptr)
+        , mSymbols(nullptr)
+    {
+        mStatements.SetCreator(DI::String_Expand::Create);
+
+        Ptr_OF<DI::Object> lEntry;
+
+        lEntry.Set(&mBudget_us     , false); AddEntry("Budget"        , lEntry, &MD_BUDGET);
+        lEntry.Set(&mCircuit_us    , false); AddEntry("Circuit"       , lEntry, &MD_CIRCUIT);
+        lEntry.Set(&mCoil_us       , false); AddEntry("Coil"          , lEntry, &MD_COIL);
+        lEntry.Set(&mContact_us    , false); AddEntry("Contact"       , lEntry, &MD_CONTACT);
+        lEntry.Set(&mCusFn_us      , false); AddEntry("CusFn"         , lEntry, &MD_CUSFN);
+        lEntry.Set(&mLoopIterations, false); AddEntry("LoopIterations", lEntry, &MD_LOOP_ITERATIONS);
+        lEntry.Set(&mStatement_us  , false); AddEntry("Statement"     , lEntry, &MD_STATEMENT);
+        lEntry.Set(&mStatements    , false); AddEntry("Statements"    , lEntry, &MD_STATEMENTS);
+    }
+
+    // The total is the time of the circuits, it contains the time of the
+    // functions the CusFn coils call. The functions are also reported
+    // alone, so the most expensive ones are easy to find.
+    uint64_t ScanTime::Report(std::ostream& aOut, const SymbolTable& aSymbols, const LineList& aCircuits, FunctionList* aFunctions)
+    {
+        assert(nullptr != aFunctions);
+
+        mFunctions = aFunctions;
+        mSymbols   = &aSymbols;
+
+        mCosts.clear();
+        mCycle = NO_CYCLE;
+
+        mFunctions_Done.clear();
+
+        for (const auto& lSC : STATEMENT_COSTS)
+        {
+            mCosts[lSC.mKeyword] = lSC.mCost_us;
+        }
+
+        for (const auto& lEntry : mStatements.mInternal)
+        {
+            auto lStatement = dynamic_cast<const DI::String*>(lEntry.Get());
+            assert(nullptr != lStatement);
+
+            std::string lKeyword;
+            uint64_t    lCost_us;
+
+            if (ParseStatementCost(lStatement->Get(), &lKeyword, &lCost_us))
+            {
+                mCosts[lKeyword] = lCost_us;
+            }
+        }
+
+        uint64_t lResult = 0;
+
+        auto lCount = aCircuits.GetLineCount();
+
+        for (unsigned int i = 0; i < lCount; i++)
+        {
+            auto lLine = aCircuits.GetLine(i);
+
+            auto lCost_us = Estimate_Circuit(lLine);
+            if (0 < lCost_us)
+            {
+                std::string lText;
+
+                for (auto lPtr = lLine; (L'\0' != *lPtr) && (L'\r' != *lPtr); lPtr++)
+                {
+                    lText += static_cast<char>(*lPtr);
+                }
+
+                aOut << "    Circuit " << (i + 1) << "  " << lCost_us << " us  " << lText << "\n";
+
+                lResult += lCost_us;
+            }
+        }
+
+        auto lFunctionCount = aFunctions->GetCount();
+
+        for (unsigned int i = 0, lFound = 0; lFound < lFunctionCount; i++)
+        {
+            auto lFunction = aFunctions->Find_ByIndex(i);
+            if (nullptr != lFunction)
+            {
+                aOut << "    Function " << lFunction->GetName() << "  " << Estimate_Function(lFunction) << " us\n";
+
+                lFound++;
+            }
+        }
+
+        aOut << "    Total  " << lResult << " us\n";
+
+        return lResult;
+    }
+
+    // ===== DI::Container ==================================================
+
+    void ScanTime::Validate() const
+    {
+        DI::Dictionary::Validate();
+
+        KMS_EXCEPTION_ASSERT(0 < mLoopIterations, RESULT_INVALID_CONFIG, "ScanTime.LoopIterations must not be 0", "");
+
+        for (const auto& lEntry : mStatements.mInternal)
+        {
+            auto lStatement = dynamic_cast<const DI::String*>(lEntry.Get());
+            assert(nullptr != lStatement);
+
+            std::string lKeyword;
+            uint64_t    lCost_us;
+
+            KMS_EXCEPTION_ASSERT(ParseStatementCost(lStatement->Get(), &lKeyword, &lCost_us), RESULT_INVALID_CONFIG, "Invalid ScanTime.Statements entry", lStatement->Get());
+        }
+    }
+
+    // Private
+    // //////////////////////////////////////////////////////////////////////
+
+    uint64_t ScanTime::GetCost(const char* aKeyword) const
+    {
+        assert(nullptr != aKeyword);
+
+        std::string lKeyword(aKeyword);
+
+        ToUpper(&lKeyword);
+
+        auto lIt = mCosts.find(lKeyword);
+
+        return (mCosts.end() == lIt) ? mStatement_us.Get() : lIt->second;
+    }
+
+    // The block ends before the line starting with aEnd0 or aEnd1, or at
+    // the end of the function.
+    uint64_t ScanTime::Estimate_Block(const Function& aFunction, unsigned int* aLine, const char* aEnd0, const char* aEnd1)
+    {
+        assert(nullptr != aLine);
+
+        uint64_t lResult = 0;
+
+        auto lCount = aFunction.GetLineCount();
+
+        while (lCount > *aLine)
+        {
+            char lKeyword[NAME_LENGTH];
+
+            auto lArgs = GetKeyword(aFunction.GetLine(*aLine), lKeyword, sizeof(lKeyword));
+
+            if ('\0' == lKeyword[0])
+            {
+                (*aLine)++;
+                continue;
+            }
+
+            if (((nullptr != aEnd0) && (0 == _stricmp(aEnd0, lKeyword))) || ((nullptr != aEnd1) && (0 == _stricmp(aEnd1, lKeyword))))
+            {
+                break;
+            }
+
+            (*aLine)++;
+
+            if (0 == _stricmp("IF", lKeyword))
+            {
+                if (IsBlock(lArgs))
+                {
+                    auto lThen = Estimate_Block(aFunction, aLine, "ELSE", "ENDIF");
+                    uint64_t lElse = 0;
+
+                    if (lCount > *aLine)
+                    {
+                        GetKeyword(aFunction.GetLine(*aLine), lKeyword, sizeof(lKeyword));
+                    }
+
+                    if ((lCount > *aLine) && (0 == _stricmp("ELSE", lKeyword)))
+                    {
+                        (*aLine)++;
+
+                        lElse = Estimate_Block(aFunction, aLine, "ENDIF", nullptr);
+                    }
+
+                    (*aLine)++;
+
+                    lResult += GetCost("IF") + std::max(lThen, lElse);
+                }
+                else
+                {
+                    lResult += GetCost("IF") + mStatement_us;
+                }
+            }
+            else if (0 == _stricmp("FOR", lKeyword))
+            {
+                uint64_t lIterations;
+
+                if (!GetIterations(lArgs, &lIterations))
+                {
+                    lIterations = mLoopIterations;
+                }
+
+                auto lBody = Estimate_Block(aFunction, aLine, "NEXT", nullptr);
+
+                (*aLine)++;
+
+                lResult += GetCost("FOR") + (lBody + GetCost("NEXT")) * lIterations;
+            }
+            else if (0 == _stricmp("WHILE", lKeyword))
+            {
+                auto lBody = Estimate_Block(aFunction, aLine, "ENDWHILE", nullptr);
+
+                (*aLine)++;
+
+                lResult += (GetCost("WHILE") + lBody) * mLoopIterations + GetCost("WHILE");
+            }
+            else if (0 == _stricmp("CALL", lKeyword))
+            {
+                auto lNumber = mFunctions->GetNumber(lArgs);
+
+                lResult += GetCost("CALL");
+                lResult += (0 < lNumber) ? Estimate_Function(mFunctions->Find_ByIndex(lNumber - 1)) : Estimate_AnyFunction();
+            }
+            else
+            {
+                lResult += GetCost(lKeyword);
+            }
+        }
+
+        return lResult;
+    }
+
+    // Coil=Contacts, the coil name may follow % and the letter giving its
+    // type. An empty line costs nothing.
+    uint64_t ScanTime::Estimate_Circuit(const wchar_t* aLine)
+    {
+        assert(nullptr != aLine);
+
+        auto lEqual = wcschr(aLine, L'=');
+        if (nullptr == lEqual)
+        {
+            return 0;
+        }
+
+        uint64_t lResult = mCircuit_us + mCoil_us;
+
+        auto lIn = aLine;
+
+        if ((L'%' == lIn[0]) && (L'\0' != lIn[1]))
+        {
+            char lName[NAME_LENGTH];
+            unsigned int lLength = 0;
+
+            for (lIn += 2; (lEqual > lIn) && (sizeof(lName) - 1 > lLength); lIn++)
+            {
+                lName[lLength] = static_cast<char>(*lIn);
+                lLength++;
+            }
+
+            lName[lLength] = '\0';
+
+            auto lFunction = static_cast<Function*>(mSymbols->Find(lName, SymbolKind::FUNCTION));
+            if (nullptr != lFunction)
+            {
+                lResult += mCusFn_us + Estimate_Function(lFunction);
+            }
+        }
+
+        auto lInName = false;
+
+        for (lIn = lEqual + 1; L'\0' != *lIn; lIn++)
+        {
+            auto lNameChar = (0x80 > *lIn) && IsNameChar(static_cast<char>(*lIn));
+
+            if (lNameChar && !lInName)
+            {
+                lResult += mContact_us;
+            }
+
+            lInName = lNameChar;
+        }
+
+        return lResult;
+    }
+
+    // An expression or a variable gives the function number, the most
+    // expensive function is the worst case.
+    uint64_t ScanTime::Estimate_AnyFunction()
+    {
+        uint64_t lResult = 0;
+
+        auto lCount = mFunctions->GetCount();
+
+        for (unsigned int i = 0, lFound = 0; lFound < lCount; i++)
+        {
+            auto lFunction = mFunctions->Find_ByIndex(i);
+            if (nullptr != lFunction)
+            {
+                lResult = std::max(lResult, Estimate_Function(lFunction));
+
+                lFound++;
+            }
+        }
+
+        return lResult;
+    }
+
+    // A recursive call costs nothing, so the functions between the called
+    // one and the recursive call get a partial cost. mCycle is the lowest
+    // position in mFunctions_InProgress a recursive call reached, these
+    // functions are estimated again at each call. The function the
+    // recursive call reaches is complete, it is kept.
+    uint64_t ScanTime::Estimate_Function(Function* aFunction)
+    {
+        if (nullptr == aFunction)
+        {
+            return 0;
+        }
+
+        auto lIt = mFunctions_Done.find(aFunction);
+        if (mFunctions_Done.end() != lIt)
+        {
+            return lIt->second;
+        }
+
+        auto lInProgress = std::find(mFunctions_InProgress.begin(), mFunctions_InProgress.end(), aFunction);
+        if (mFunctions_InProgress.end() != lInProgress)
+        {
+            mCycle = std::min(mCycle, static_cast<unsigned int>(lInProgress - mFunctions_InProgress.begin()));
+            return 0;
+        }
+
+        auto lCycle    = mCycle;
+        auto lPosition = static_cast<unsigned int>(mFunctions_InProgress.size());
+
+        mCycle = NO_CYCLE;
+
+        mFunctions_InProgress.push_back(aFunction);
+
+        unsigned int lLine = 0;
+
+        auto lResult = Estimate_Block(*aFunction, &lLine, nullptr, nullptr);
+
+        mFunctions_InProgress.pop_back();
+
+        if (lPosition <= mCycle)
+        {
+            mFunctions_Done[aFunction] = lResult;
+
+            mCycle = lCycle;
+        }
+        else
+        {
+            mCycle = std::min(mCycle, lCycle);
+        }
+
+        return lResult;
+    }
+
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// A label (@n) may precede the statement. A comment starts with ' , // or
+// REM.
+const char* GetKeyword(const char* aLine, char* aOut, unsigned int aOutSize_byte)
+{
+    assert(nullptr != aLine);
+    assert(nullptr != aOut);
+    assert(0 < aOutSize_byte);
+
+    auto lIn = aLine;
+
+    aOut[0] = '\0';
+
+    while ((' ' == *lIn) || ('\t' == *lIn)) { lIn++; }
+
+    if ('@' == *lIn)
+    {
+        lIn++;
+
+        while (isdigit(static_cast<unsigned char>(*lIn))) { lIn++; }
+        while ((' ' == *lIn) || ('\t' == *lIn)) { lIn++; }
+    }
+
+    if (('\'' == lIn[0]) || (('/' == lIn[0]) && ('/' == lIn[1])))
+    {
+        return lIn;
+    }
+
+    unsigned int lLength = 0;
+
+    while (IsNameChar(*lIn))
+    {
+        if (aOutSize_byte - 1 > lLength)
+        {
+            aOut[lLength] = *lIn;
+            lLength++;
+        }
+
+        lIn++;
+    }
+
+    aOut[lLength] = '\0';
+
+    if (0 == _stricmp("REM", aOut))
+    {
+        aOut[0] = '\0';
+    }
+
+    return lIn;
+}
+
+bool GetIterations(const char* aArgs, uint64_t* aOut)
+{
+    assert(nullptr != aArgs);
+    assert(nullptr != aOut);
+
+    auto lIn = strchr(aArgs, '=');
+    if (nullptr == lIn)
+    {
+        return false;
+    }
+
+    char* lEnd;
+
+    auto lFirst = strtol(lIn + 1, &lEnd, 10);
+    if (lIn + 1 == lEnd) { return false; }
+
+    lIn = lEnd;
+
+    while (' ' == *lIn) { lIn++; }
+
+    if (0 != _strnicmp("TO", lIn, 2)) { return false; }
+
+    auto lLast = strtol(lIn + 2, &lEnd, 10);
+    if (lIn + 2 == lEnd) { return false; }
+
+    lIn = lEnd;
+
+    while (' ' == *lIn) { lIn++; }
+
+    long lStep = 1;
+
+    if (0 == _strnicmp("STEP", lIn, 4))
+    {
+        lStep = strtol(lIn + 4, &lEnd, 10);
+        if ((lIn + 4 == lEnd) || (0 == lStep)) { return false; }
+
+        lIn = lEnd;
+
+        while (' ' == *lIn) { lIn++; }
+    }
+
+    if (('\0' != *lIn) && ('\r' != *lIn) && ('\'' != *lIn))
+    {
+        return false;
+    }
+
+    auto lCount = (lLast - lFirst) / lStep + 1;
+
+    *aOut = (0 < lCount) ? lCount : 0;
+
+    return true;
+}
+
+bool IsBlock(const char* aArgs)
+{
+    assert(nullptr != aArgs);
+
+    std::string lArgs(aArgs);
+
+    auto lComment = lArgs.find('\'');
+    if (std::string::npos != lComment)
+    {
+        lArgs.erase(lComment);
+    }
+
+    auto lEnd = lArgs.find_last_not_of(" \t\r\n");
+    if ((std::string::npos == lEnd) || (4 > lEnd + 1))
+    {
+        return false;
+    }
+
+    return (0 == _strnicmp("THEN", lArgs.c_str() + lEnd - 3, 4)) && ((4 == lEnd + 1) || !IsNameChar(lArgs[lEnd - 4]));
+}
+
+bool IsNameChar(char aC)
+{
+    return isalnum(static_cast<unsigned char>(aC)) || ('_' == aC) || ('$' == aC);
+}
+
+// Keyword:Cost
+bool ParseStatementCost(const char* aIn, std::string* aKeyword, uint64_t* aCost_us)
+{
+    assert(nullptr != aIn);
+    assert(nullptr != aKeyword);
+    assert(nullptr != aCost_us);
+
+    auto lColon = strchr(aIn, ':');
+    if ((nullptr == lColon) || (aIn == lColon) || !isdigit(static_cast<unsigned char>(lColon[1])))
+    {
+        return false;
+    }
+
+    char* lEnd;
+
+    *aCost_us = strtoull(lColon + 1, &lEnd, 10);
+    if ('\0' != *lEnd)
+    {
+        return false;
+    }
+
+    aKeyword->assign(aIn, lColon - aIn);
+
+    ToUpper(aKeyword);
+
+    return true;
+}
+
+void ToUpper(std::string* aInOut)
+{
+    assert(nullptr != aInOut);
+
+    for (auto& lC : *aInOut)
+    {
+        lC = static_cast<char>(toupper(static_cast<unsigned char>(lC)));
+    }
+}
@@ -0,0 +1,134 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI_SectionIndex.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/TRiLOGI/SectionIndex.h"
+
+#include "TRiLOGI/PC6.h"
+
+using namespace KMS;
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define SECTION_QTY (static_cast<unsigned int>(TRiLOGI::SectionId::QTY))
+
+// Most sections end at the first line starting with PC6_SECTION_END_C. The
+// function code and function name sections end only at their exact
+// terminator, as FunctionList::Parse_Code and Parse_Name always did.
+static const wchar_t* TERMINATORS[SECTION_QTY] =
+{
+    nullptr,                     // INPUTS
+    nullptr,                     // OUTPUTS
+    nullptr,                     // RELAYS
+    nullptr,                     // TIMERS
+    nullptr,                     // COUNTERS
+    nullptr,                     // CIRCUITS
+    PC6_SECTION_END_CUSTFN,      // FUNCTIONS
+    PC6_SECTION_END_CUSTFNLABEL, // FUNCTION_NAMES
+    nullptr,                     // QUICK_TAGS
+    nullptr,                     // DEFINES
+    nullptr,                     // FOOTER
+};
+
+namespace TRiLOGI
+{
+
+    // Public
+    // //////////////////////////////////////////////////////////////////////
+
+    SectionIndex::SectionIndex() { Clear(); }
+
+    void SectionIndex::Build(const File_PC6& aFile_PC6)
+    {
+        auto lLineCount = aFile_PC6.GetLineCount();
+
+        // The first line is the file header
+        unsigned int lLineNo  = 1;
+        unsigned int lSection = 0;
+
+        mFirst[lSection] = lLineNo;
+
+        for (; (lLineNo < lLineCount) && (SECTION_QTY - 1 > lSection); lLineNo++)
+        {
+            auto lLine = aFile_PC6.GetLine(lLineNo);
+            assert(nullptr != lLine);
+
+            if (PC6_SECTION_END_C != lLine[0])
+            {
+                continue;
+            }
+
+            auto lTerminator = TERMINATORS[lSection];
+            if ((nullptr == lTerminator) || (0 == wcscmp(lTerminator, lLine)))
+            {
+                mEnd[lSection] = lLineNo;
+
+                lSection++;
+
+                mFirst[lSection] = lLineNo + 1;
+            }
+        }
+
+        // Missing terminators leave the following sections empty, as the
+        // sequential parsers did.
+        for (; lSection < SECTION_QTY; lSection++)
+        {
+            if (mFirst[lSection] > lLineCount)
+            {
+                mFirst[lSection] = lLineCount;
+            }
+
+            mEnd[lSection] = lLineCount;
+
+            if (SECTION_QTY > lSection + 1)
+            {
+                mFirst[lSection + 1] = lLineCount;
+            }
+        }
+
+        mValid = true;
+    }
+
+    void SectionIndex::Clear()
+    {
+        memset(&mEnd  , 0, sizeof(mEnd  ));
+        memset(&mFirst, 0, sizeof(mFirst));
+
+        mValid = false;
+    }
+
+    unsigned int SectionIndex::GetEnd(SectionId aId) const
+    {
+        assert(SectionId::QTY > aId);
+
+        return mEnd[static_cast<unsigned int>(aId)];
+    }
+
+    unsigned int SectionIndex::GetFirst(SectionId aId) const
+    {
+        assert(SectionId::QTY > aId);
+
+        return mFirst[static_cast<unsigned int>(aId)];
+    }
+
+    bool SectionIndex::IsValid() const { return mValid; }
+
+    void SectionIndex::Set(SectionId aId, unsigned int aFirst, unsigned int aEnd)
+    {
+        assert(SectionId::QTY > aId);
+        assert(aFirst <= aEnd);
+
+        mEnd  [static_cast<unsigned int>(aId)] = aEnd;
+        mFirst[static_cast<unsigned int>(aId)] = aFirst;
+
+        mValid = true;
+    }
+
+}
@@ -0,0 +1,210 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI_SymbolTable.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "../Common/TRiLOGI/SymbolTable.h"
+
+#include "TRiLOGI/Object.h"
+#include "Utilities.h"
+
+using namespace KMS;
+
+namespace TRiLOGI
+{
+
+    // Public
+    // //////////////////////////////////////////////////////////////////////
+
+    Symbol::Symbol() : mObjects() {}
+
+    Object* Symbol::GetObject(SymbolKind aKind) const
+    {
+        assert(SymbolKind::QTY > aKind);
+
+        return mObjects[static_cast<unsigned int>(aKind)];
+    }
+
+    SymbolTable::SymbolTable() : mParallel(false) {}
+
+    void SymbolTable::BeginParallel()
+    {
+        assert(!mParallel);
+
+        mParallel = true;
+    }
+
+    void SymbolTable::EndParallel()
+    {
+        assert(mParallel);
+
+        mParallel = false;
+    }
+
+    void SymbolTable::Clear()
+    {
+        auto lLock = Lock();
+
+        mSymbols.clear();
+    }
+
+    const Symbol* SymbolTable::Find(const char* aName) const
+    {
+        assert(nullptr != aName);
+
+        auto lLock = Lock();
+
+        auto lIt = mSymbols.find(aName);
+
+        return (mSymbols.end() == lIt) ? nullptr : &lIt->second;
+    }
+
+    Object* SymbolTable::Find(const char* aName, SymbolKind aKind) const
+    {
+        auto lSymbol = Find(aName);
+
+        return (nullptr == lSymbol) ? nullptr : lSymbol->GetObject(aKind);
+    }
+
+    unsigned int SymbolTable::GetCount() const
+    {
+        auto lLock = Lock();
+
+        return static_cast<unsigned int>(mSymbols.size());
+    }
+
+    bool SymbolTable::Insert(SymbolKind aKind, Object* aObject)
+    {
+        assert(SymbolKind::QTY > aKind);
+        assert(nullptr != aObject);
+
+        auto lLock = Lock();
+
+        auto lIt = mSymbols.find(aObject->GetName());
+        if (mSymbols.end() == lIt)
+        {
+            lIt = mSymbols.insert(SymbolMap::value_type(aObject->GetName(), Symbol())).first;
+        }
+
+        auto& lSlot = lIt->second.mObjects[static_cast<unsigned int>(aKind)];
+        if (nullptr != lSlot)
+        {
+            return false;
+        }
+
+        lSlot = aObject;
+
+        return true;
+    }
+
+    // A function parsed without a name is not in the table, so its removal
+    // does nothing. The DefineList holds objects of two kinds, so the slot
+    // is found using the object itself.
+    void SymbolTable::Remove(const Object* aObject)
+    {
+        assert(nullptr != aObject);
+
+        auto lLock = Lock();
+
+        auto lIt = mSymbols.find(aObject->GetName());
+        if (mSymbols.end() != lIt)
+        {
+            for (auto& lSlot : lIt->second.mObjects)
+            {
+                if (aObject == lSlot)
+                {
+                    lSlot = nullptr;
+                }
+            }
+
+            UpdateKey(lIt);
+        }
+    }
+
+    void SymbolTable::Replace(SymbolKind aKind, Object* aObject)
+    {
+        assert(SymbolKind::QTY > aKind);
+        assert(nullptr != aObject);
+
+        auto lLock = Lock();
+
+        auto lIt = mSymbols.find(aObject->GetName());
+        assert(mSymbols.end() != lIt);
+
+        auto& lSlot = lIt->second.mObjects[static_cast<unsigned int>(aKind)];
+        assert(nullptr != lSlot);
+
+        lSlot = aObject;
+
+        UpdateKey(lIt);
+    }
+
+    // Private
+    // //////////////////////////////////////////////////////////////////////
+
+    // The lock is taken only while the sections are parsed in parallel
+    std::unique_lock<std::mutex> SymbolTable::Lock() const
+    {
+        std::unique_lock<std::mutex> lResult(mMutex, std::defer_lock);
+
+        if (mParallel)
+        {
+            lResult.lock();
+        }
+
+        return lResult;
+    }
+
+    bool SymbolTable::NameEqual::operator () (const char* aA, const char* aB) const
+    {
+        assert(nullptr != aA);
+        assert(nullptr != aB);
+
+        return 0 == strcmp(aA, aB);
+    }
+
+    size_t SymbolTable::NameHash::operator () (const char* aName) const
+    {
+        assert(nullptr != aName);
+
+        return static_cast<size_t>(Utl_Hash(aName, static_cast<unsigned int>(strlen(aName))));
+    }
+
+    // The key of a map element cannot change, the element is inserted
+    // again using the name of a remaining object.
+    void SymbolTable::UpdateKey(SymbolMap::iterator aIt)
+    {
+        const Object* lFirst = nullptr;
+
+        for (auto lObject : aIt->second.mObjects)
+        {
+            if (nullptr != lObject)
+            {
+                if (aIt->first == lObject->GetName())
+                {
+                    return;
+                }
+
+                if (nullptr == lFirst)
+                {
+                    lFirst = lObject;
+                }
+            }
+        }
+
+        auto lSymbol = aIt->second;
+
+        mSymbols.erase(aIt);
+
+        if (nullptr != lFirst)
+        {
+            mSymbols.insert(SymbolMap::value_type(lFirst->GetName(), lSymbol));
+        }
+    }
+
+}
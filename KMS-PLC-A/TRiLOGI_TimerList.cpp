@@ -22,12 +22,12 @@ namespace TRiLOGI
     // Public
     // //////////////////////////////////////////////////////////////////////
 
-    TimerList::TimerList() : ObjectList("timer", 128) {}
+    TimerList::TimerList() : TypedList("timer", 128, SymbolKind::TIMER) {}
 
     bool TimerList::Import(const char* aName, unsigned int aInit)
     {
-        auto lObject = FindObject_ByName(aName);
-        if (nullptr == lObject)
+        auto lTimer = Find_ByName(aName);
+        if (nullptr == lTimer)
         {
             if (IsProjectLegacy())
             {
@@ -36,26 +36,27 @@ namespace TRiLOGI
 
             auto lIndex = FindFreeIndex();
 
-            auto lTimer = new Timer(aName, lIndex, aInit);
+            auto lNew = NewObject<Timer>(aName, lIndex, aInit);
 
-            ObjectList::AddObject(lTimer);
+            ObjectList::AddObject(lNew);
 
             return true;
         }
 
         // NOT TESTED
-        auto lTimer = dynamic_cast<Timer*>(lObject);
-        assert(nullptr != lTimer);
+        auto lResult = lTimer->SetInit(aInit);
+        if (lResult)
+        {
+            SetDirty();
+        }
 
-        return lTimer->SetInit(aInit);
+        return lResult;
     }
 
     // Protected
     // //////////////////////////////////////////////////////////////////////
 
-    // ===== ObjectList =====================================================
-
-    void TimerList::AddObject(const wchar_t* aLine, unsigned int)
+    void TimerList::ParseLine(const wchar_t* aLine, unsigned int)
     {
         assert(nullptr != aLine);
 
@@ -66,9 +67,20 @@ namespace TRiLOGI
         auto lRet = swscanf_s(aLine, L"%u,%S %u", &lIndex, lName SizeInfo(lName), &lInit);
         KMS_EXCEPTION_ASSERT(3 == lRet, RESULT_INVALID_FORMAT, "Invalid timer line", lRet);
 
-        auto lTimer = new Timer(lName, lIndex, lInit);
+        auto lTimer = NewObject<Timer>(lName, lIndex, lInit);
 
         ObjectList::AddObject(lTimer);
     }
 
+    void TimerList::ReadSnapshotRecord(SnapshotReader* aReader, unsigned int)
+    {
+        assert(nullptr != aReader);
+
+        auto lIndex = aReader->Get_UInt  ();
+        auto lName  = aReader->Get_String();
+        auto lInit  = aReader->Get_UInt  ();
+
+        ObjectList::AddObject(NewObject<Timer>(lName, lIndex, lInit));
+    }
+
 }
@@ -0,0 +1,260 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI_UsageCounter.cpp
+
+#include "Component.h"
+
+// ===== C++ ================================================================
+#include <codecvt>
+#include <queue>
+
+// ===== Local ==============================================================
+#include "../Common/TRiLOGI/File_PC6.h"
+
+#include "TRiLOGI/UsageCounter.h"
+
+using namespace KMS;
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define NONE (0xffffffff)
+
+#define ROOT (0)
+
+namespace TRiLOGI
+{
+
+    // Public
+    // //////////////////////////////////////////////////////////////////////
+
+    UsageCounter::UsageCounter() : mClassCount(1), mLineCount(0)
+    {
+        memset(&mClasses_ASCII, 0, sizeof(mClasses_ASCII));
+    }
+
+    void UsageCounter::AddName(const char* aName)
+    {
+        assert(nullptr != aName);
+
+        assert(mGoTo.empty());
+
+        if (('\0' != aName[0]) && (mPatterns.end() == mPatterns.find(aName)))
+        {
+            std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> lConverter;
+
+            auto lPattern = static_cast<unsigned int>(mPatterns_W.size());
+
+            mPatterns.insert(PatternMap::value_type(aName, lPattern));
+            mPatterns_W.push_back(lConverter.from_bytes(aName));
+        }
+    }
+
+    // The line numbers continue from a file to the next, so an occurrence
+    // is never compared with an occurrence of another file.
+    void UsageCounter::Count(const File_PC6& aFile_PC6)
+    {
+        if (mGoTo.empty())
+        {
+            Compile();
+        }
+
+        auto lLineCount = aFile_PC6.GetLineCount();
+
+        for (unsigned int lLineNo = 0; lLineNo < lLineCount; lLineNo++)
+        {
+            auto lLine = aFile_PC6.GetLine(lLineNo);
+            assert(nullptr != lLine);
+
+            Count(lLine, mLineCount + lLineNo);
+        }
+
+        mLineCount += lLineCount;
+    }
+
+    unsigned int UsageCounter::GetCount(const char* aName) const
+    {
+        assert(nullptr != aName);
+
+        auto lIt = mPatterns.find(aName);
+        if (mPatterns.end() == lIt)
+        {
+            return 0;
+        }
+
+        assert(mCounts.size() > lIt->second);
+
+        return mCounts[lIt->second];
+    }
+
+    // Private
+    // //////////////////////////////////////////////////////////////////////
+
+    // Build the trie, then use a breadth first walk to compute the failure
+    // links and complete the transition table. The result is a DFA, so Count
+    // never follows a failure link.
+    void UsageCounter::Compile()
+    {
+        assert(mGoTo.empty());
+
+        auto lPatternCount = static_cast<unsigned int>(mPatterns_W.size());
+
+        mCounts   .assign(lPatternCount, 0);
+        mLastEnds .assign(lPatternCount, 0);
+        mLastLines.assign(lPatternCount, NONE);
+        mLengths  .resize(lPatternCount);
+
+        // Each character used in a pattern gets a class. All the other
+        // characters share the class 0.
+        for (unsigned int p = 0; p < lPatternCount; p++)
+        {
+            for (auto lC : mPatterns_W[p])
+            {
+                if (128 > static_cast<unsigned int>(lC))
+                {
+                    if (0 == mClasses_ASCII[lC])
+                    {
+                        mClasses_ASCII[lC] = mClassCount;
+                        mClassCount++;
+                    }
+                }
+                else if (mClasses_Other.end() == mClasses_Other.find(lC))
+                {
+                    mClasses_Other.insert(std::unordered_map<wchar_t, unsigned int>::value_type(lC, mClassCount));
+                    mClassCount++;
+                }
+            }
+        }
+
+        // ===== Trie =======================================================
+        mGoTo     .assign(mClassCount, NONE);
+        mOutputs  .assign(1, NONE);
+
+        for (unsigned int p = 0; p < lPatternCount; p++)
+        {
+            unsigned int lNode = ROOT;
+
+            for (auto lC : mPatterns_W[p])
+            {
+                auto lClass = GetClass(lC);
+                auto lNext  = mGoTo[lNode * mClassCount + lClass];
+
+                if (NONE == lNext)
+                {
+                    lNext = static_cast<unsigned int>(mOutputs.size());
+
+                    mGoTo[lNode * mClassCount + lClass] = lNext;
+
+                    mGoTo   .resize(mGoTo.size() + mClassCount, NONE);
+                    mOutputs.push_back(NONE);
+                }
+
+                lNode = lNext;
+            }
+
+            mLengths[p] = static_cast<unsigned int>(mPatterns_W[p].size());
+            mOutputs[lNode] = p;
+        }
+
+        // ===== Failure links ==============================================
+        auto lNodeCount = static_cast<unsigned int>(mOutputs.size());
+
+        UIntVector lFails(lNodeCount, ROOT);
+
+        mDictLinks.assign(lNodeCount, NONE);
+
+        std::queue<unsigned int> lQueue;
+
+        for (unsigned int c = 0; c < mClassCount; c++)
+        {
+            auto& lNext = mGoTo[ROOT * mClassCount + c];
+            if (NONE == lNext)
+            {
+                lNext = ROOT;
+            }
+            else
+            {
+                lQueue.push(lNext);
+            }
+        }
+
+        while (!lQueue.empty())
+        {
+            auto lNode = lQueue.front();
+            lQueue.pop();
+
+            auto lFail = lFails[lNode];
+
+            // The dictionary link points to the longest proper suffix which
+            // is also a complete pattern.
+            mDictLinks[lNode] = (NONE == mOutputs[lFail]) ? mDictLinks[lFail] : lFail;
+
+            for (unsigned int c = 0; c < mClassCount; c++)
+            {
+                auto& lNext = mGoTo[lNode * mClassCount + c];
+                if (NONE == lNext)
+                {
+                    lNext = mGoTo[lFail * mClassCount + c];
+                }
+                else
+                {
+                    lFails[lNext] = mGoTo[lFail * mClassCount + c];
+
+                    lQueue.push(lNext);
+                }
+            }
+        }
+    }
+
+    unsigned int UsageCounter::GetClass(wchar_t aC) const
+    {
+        if (128 > static_cast<unsigned int>(aC))
+        {
+            return mClasses_ASCII[aC];
+        }
+
+        auto lIt = mClasses_Other.find(aC);
+
+        return (mClasses_Other.end() == lIt) ? 0 : lIt->second;
+    }
+
+    void UsageCounter::Count(const wchar_t* aLine, unsigned int aLineNo)
+    {
+        assert(nullptr != aLine);
+
+        unsigned int lNode = ROOT;
+
+        for (unsigned int lEnd = 1; L'\0' != aLine[lEnd - 1]; lEnd++)
+        {
+            lNode = mGoTo[lNode * mClassCount + GetClass(aLine[lEnd - 1])];
+
+            auto lMatch = (NONE == mOutputs[lNode]) ? mDictLinks[lNode] : lNode;
+
+            while (NONE != lMatch)
+            {
+                auto lPattern = mOutputs[lMatch];
+                assert(NONE != lPattern);
+
+                if (mLastLines[lPattern] != aLineNo)
+                {
+                    mLastLines[lPattern] = aLineNo;
+                    mLastEnds [lPattern] = 0;
+                }
+
+                // Ignore a match overlapping the previous one of the same
+                // pattern
+                if (mLastEnds[lPattern] + mLengths[lPattern] <= lEnd)
+                {
+                    mCounts  [lPattern]++;
+                    mLastEnds[lPattern] = lEnd;
+                }
+
+                lMatch = mDictLinks[lMatch];
+            }
+        }
+    }
+
+}
@@ -10,6 +10,10 @@
 #include "Component.h"
 
 // ===== Local ==============================================================
+#include "../Common/TRiLOGI/RecordWriter.h"
+#include "../Common/Snapshot.h"
+#include "../Common/TRiLOGI/SymbolTable.h"
+
 #include "TRiLOGI/Word.h"
 
 namespace TRiLOGI
@@ -24,25 +28,41 @@ namespace TRiLOGI
 
     unsigned int Word::GetOffset() const { return mOffset; }
 
+    void Word::SetOffset(unsigned int aOffset) { mOffset = aOffset; }
+
     // ===== Object =========================================================
 
     Word::~Word() {}
 
-    void Word::GetLine(wchar_t* aOut, unsigned int aOutSize_byte) const
+    void Word::WriteRecord(RecordWriter* aWriter) const
     {
-        assert(nullptr != aOut);
+        assert(nullptr != aWriter);
 
-        unsigned int lOutLen = aOutSize_byte / sizeof(wchar_t);
+        Object::WriteRecord(aWriter);
 
-        if (mComment.empty())
-        {
-            swprintf_s(aOut SizeInfoV(lOutLen), L"%u,%S,DM[%u]", GetIndex(), GetName(), mOffset);
-        }
-        else
+        aWriter->Add(L",DM[");
+        aWriter->Add_UInt(mOffset);
+        aWriter->Add(L']');
+
+        if (!mComment.empty())
         {
             // NOT TESTED
-            swprintf_s(aOut SizeInfoV(lOutLen), L"%u,%S,DM[%u],%S", GetIndex(), GetName(), mOffset, mComment.c_str());
+            aWriter->Add(L',');
+            aWriter->Add(mComment.c_str());
         }
     }
 
+    // The DefineList contains words and constants, the kind comes first
+    void Word::WriteSnapshot(SnapshotWriter* aWriter) const
+    {
+        assert(nullptr != aWriter);
+
+        aWriter->Add_UInt(static_cast<unsigned int>(SymbolKind::WORD));
+
+        Object::WriteSnapshot(aWriter);
+
+        aWriter->Add_UInt  (mOffset);
+        aWriter->Add_String(mComment.c_str());
+    }
+
 }
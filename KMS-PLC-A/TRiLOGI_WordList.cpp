@@ -16,6 +16,7 @@
 #include "../Common/TRiLOGI/WordList.h"
 
 #include "TRiLOGI/Word.h"
+#include "TRiLOGI/WordRelocation.h"
 
 using namespace KMS;
 
@@ -49,6 +50,7 @@ namespace TRiLOGI
         : mOffsetMax(OFFSET_MAX_DEFAULT)
         , mOffsetNew(OFFSET_NEW_DEFAULT_LEGACY)
         , mProjectType(ProjectType::LEGACY)
+        , mUsed(OFFSET_MAX + 1)
     {
         Ptr_OF<DI::Object> lEntry;
 
@@ -56,25 +58,6 @@ namespace TRiLOGI
         lEntry.Set(&mOffsetNew, false); AddEntry("OffsetNew", lEntry, &MD_OFFSET_NEW);
     }
 
-    Object* WordList::AddWord(const char* aName, unsigned int aIndex, const char* aComment)
-    {
-        unsigned int lOffset;
-
-        switch (mProjectType)
-        {
-        case ProjectType::LEGACY: lOffset = FindFreeOffset_Dec(); break;
-        case ProjectType::NEW   : lOffset = FindFreeOffset_Inc(); break;
-
-        default: assert(false);
-        }
-
-        auto lResult = new Word(aName, aIndex, lOffset, aComment);
-
-        AddWord(lResult);
-
-        return lResult;
-    }
-
     // This method only throw exception as a result of a corrupted PC6 file
     void WordList::AddWord(Word* aWord)
     {
@@ -103,43 +86,63 @@ namespace TRiLOGI
             KMS_EXCEPTION(RESULT_INVALID_VALUE, lMsg, lO);
         }
 
-        auto lBN = mWords_ByName.insert(ByName::value_type(lN, aWord));
-        if (!lBN.second)
-        {
-            sprintf_s(lMsg, "A word named \"%s\" already exist (NOT TESTED)", lN);
-            KMS_EXCEPTION(RESULT_ALREADY_EXIST, lMsg, lO);
-        }
-
         auto lBO = mWords_ByOffset.insert(ByOffset::value_type(lO, aWord));
         if (!lBO.second)
         {
             sprintf_s(lMsg, "A word already exist at offset %u (NOT TESTED)", lO);
             KMS_EXCEPTION(RESULT_ALREADY_EXIST, lMsg, lN);
         }
+
+        mUsed.Set(lO);
     }
 
     // NOT TESTED
-    void WordList::ClearList() { mWords_ByName.clear(); mWords_ByOffset.clear(); }
+    void WordList::ClearList() { mWords_ByOffset.clear(); mUsed.Clear(); }
+
+    void WordList::RemoveWord(const Word* aWord)
+    {
+        assert(nullptr != aWord);
+
+        auto lO = aWord->GetOffset();
+
+        auto lIt = mWords_ByOffset.find(lO);
+        if ((mWords_ByOffset.end() != lIt) && (aWord == lIt->second))
+        {
+            mWords_ByOffset.erase(lIt);
+
+            mUsed.Clear(lO);
+        }
+    }
 
-    void WordList::GetAddresses(const std::regex& aRegEx, AddressList* aOut) const
+    void WordList::GetAddresses(PatternSet* aPatterns, std::vector<AddressList>* aOut) const
     {
+        assert(nullptr != aPatterns);
         assert(nullptr != aOut);
 
+        std::vector<unsigned int> lMatches;
+
         for (auto lVT : mWords_ByOffset)
         {
             auto lWord = lVT.second;
             assert(nullptr != lWord);
 
+            if (lWord->TestFlag(TRiLOGI::Object::FLAG_NOT_USED))
+            {
+                continue;
+            }
+
             auto lN = lWord->GetName();
 
-            if ((!lWord->TestFlag(TRiLOGI::Object::FLAG_NOT_USED)) && std::regex_match(lN, aRegEx))
+            aPatterns->Match(lN, &lMatches);
+
+            for (auto lPattern : lMatches)
             {
-                aOut->Add(lN, AddressType::MODBUS_RTU_4X, 1000 + lWord->GetOffset());
+                (*aOut)[lPattern].Add(lN, AddressType::MODBUS_RTU_4X, 1000 + lWord->GetOffset());
             }
         }
     }
 
-    unsigned int WordList::GetCount() const { return static_cast<unsigned int>(mWords_ByName.size()); }
+    unsigned int WordList::GetCount() const { return static_cast<unsigned int>(mWords_ByOffset.size()); }
 
     const Word* WordList::Find_ByOffset(unsigned int aOffset) const
     {
@@ -154,6 +157,102 @@ namespace TRiLOGI
         return lIt->second;
     }
 
+    unsigned int WordList::ReserveOffsets(unsigned int aCount)
+    {
+        assert(0 < aCount);
+
+        unsigned int lResult;
+
+        switch (mProjectType)
+        {
+        case ProjectType::LEGACY: lResult = FindFreeOffset_Dec(aCount); break;
+        case ProjectType::NEW   : lResult = FindFreeOffset_Inc(aCount); break;
+
+        default: assert(false);
+        }
+
+        return lResult;
+    }
+
+    bool WordList::Relocate(const std::vector<unsigned int>& aOffsets, WordRelocation* aRelocation)
+    {
+        assert(nullptr != aRelocation);
+
+        auto lCount = static_cast<unsigned int>(aOffsets.size());
+        auto lMoved = false;
+
+        for (unsigned int i = 1; i < lCount; i++)
+        {
+            if (aOffsets[0] + i != aOffsets[i])
+            {
+                lMoved = true;
+                break;
+            }
+        }
+
+        if (!lMoved)
+        {
+            return false;
+        }
+
+        std::vector<Word*> lWords;
+
+        for (auto lO : aOffsets)
+        {
+            auto lIt = mWords_ByOffset.find(lO);
+            assert(mWords_ByOffset.end() != lIt);
+
+            lWords.push_back(lIt->second);
+
+            mWords_ByOffset.erase(lIt);
+
+            mUsed.Clear(lO);
+        }
+
+        unsigned int lFirst;
+
+        try
+        {
+            lFirst = ReserveOffsets(lCount);
+        }
+        catch (...)
+        {
+            for (auto lWord : lWords)
+            {
+                AddWord(lWord);
+            }
+
+            throw;
+        }
+
+        for (unsigned int i = 0; i < lCount; i++)
+        {
+            auto lWord = lWords[i];
+            auto lTo   = lFirst + i;
+
+            if (aOffsets[i] != lTo)
+            {
+                char lText_From[16];
+                char lText_To  [16];
+
+                sprintf_s(lText_From, "DM[%u]", aOffsets[i]);
+                sprintf_s(lText_To  , "DM[%u]", lTo);
+
+                ::Console::Change("Relocated", lWord->GetName(), lText_From, lText_To);
+
+                aRelocation->Add(aOffsets[i], lTo);
+            }
+
+            lWord->SetOffset(lTo);
+
+            mWords_ByOffset.insert(ByOffset::value_type(lTo, lWord));
+
+            mUsed.Set(lTo);
+        }
+
+        return true;
+    }
+
     void WordList::SetProjectType(ProjectType aPT)
     {
         assert(ProjectType::QTY > aPT);
@@ -203,50 +302,28 @@ namespace TRiLOGI
     // Private
     // //////////////////////////////////////////////////////////////////////
 
-    unsigned int WordList::FindFreeOffset_Dec()
+    // The search covers OFFSET_MIN to OffsetNew, the highest free offsets
+    // first.
+    unsigned int WordList::FindFreeOffset_Dec(unsigned int aCount)
     {
         assert(mOffsetMax >= mOffsetNew);
 
-        unsigned int lResult = mOffsetNew;
+        auto lResult = mUsed.FindZeros_Dec(OFFSET_MIN, mOffsetNew + 1, aCount);
 
-        for (auto lIt = mWords_ByOffset.rbegin(); lIt != mWords_ByOffset.rend(); lIt++)
-        {
-            if (lResult > lIt->first)
-            {
-                break; // NOT TESTED
-            }
-
-            if (lResult == lIt->first)
-            {
-                lResult = lIt->first - 1;
-            }
-        }
-
-        KMS_EXCEPTION_ASSERT(OFFSET_MIN <= lResult, RESULT_TOO_MANY, "Too many word", "");
+        KMS_EXCEPTION_ASSERT(Bitmap::NOT_FOUND != lResult, RESULT_TOO_MANY, "Too many word", "");
 
         return lResult;
     }
 
-    unsigned int WordList::FindFreeOffset_Inc()
+    // The search covers OffsetNew to OffsetMax, the lowest free offsets
+    // first.
+    unsigned int WordList::FindFreeOffset_Inc(unsigned int aCount)
     {
         assert(mOffsetMax > mOffsetNew);
 
-        unsigned int lResult = mOffsetNew;
-
-        for (auto lIt = mWords_ByOffset.begin(); lIt != mWords_ByOffset.end(); lIt++)
-        {
-            if (lResult < lIt->first)
-            {
-                break;
-            }
-
-            if (lResult == lIt->first)
-            {
-                lResult = lIt->first + 1; // NOT TESTED
-            }
-        }
+        auto lResult = mUsed.FindZeros_Inc(mOffsetNew, mOffsetMax + 1, aCount);
 
-        KMS_EXCEPTION_ASSERT(mOffsetMax >= lResult, RESULT_TOO_MANY, "Too many word", "");
+        KMS_EXCEPTION_ASSERT(Bitmap::NOT_FOUND != lResult, RESULT_TOO_MANY, "Too many word", "");
 
         return lResult;
     }
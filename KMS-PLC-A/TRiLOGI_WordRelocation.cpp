@@ -0,0 +1,201 @@
+
+// Author    KMS - Martin Dubois, P. Eng.
+// Copyright (C) 2026 KMS
+// License   http://www.apache.org/licenses/LICENSE-2.0
+// Product   KMS-PLC
+// File      KMS-PLC-A/TRiLOGI_WordRelocation.cpp
+
+#include "Component.h"
+
+// ===== Local ==============================================================
+#include "TRiLOGI/WordRelocation.h"
+
+using namespace KMS;
+
+// Constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define OFFSET_MAX (3999)
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+static bool IsDigit    (unsigned int aC);
+static bool IsNameChar (unsigned int aC);
+static bool IsNameFirst(unsigned int aC);
+
+// aName  Not terminated, aLength characters
+template <typename C>
+static bool IsName(const C* aName, unsigned int aLength, const char* aExpected);
+
+namespace TRiLOGI
+{
+
+    // Public
+    // //////////////////////////////////////////////////////////////////////
+
+    WordRelocation::WordRelocation() : mIndirectCount(0), mRewriteCount(0), mTo(OFFSET_MAX + 1, 0) {}
+
+    void WordRelocation::Add(unsigned int aFrom, unsigned int aTo)
+    {
+        assert(OFFSET_MAX >= aFrom);
+        assert(0 < aTo);
+        assert(OFFSET_MAX >= aTo);
+
+        mTo[aFrom] = static_cast<uint16_t>(aTo);
+    }
+
+    unsigned int WordRelocation::GetIndirectCount() const { return mIndirectCount; }
+    unsigned int WordRelocation::GetRewriteCount () const { return mRewriteCount; }
+
+    unsigned int WordRelocation::GetTo(unsigned int aFrom) const { return (OFFSET_MAX >= aFrom) ? mTo[aFrom] : 0; }
+
+    bool WordRelocation::Rewrite(std::string * aLine) { return Rewrite_T(aLine); }
+    bool WordRelocation::Rewrite(std::wstring* aLine) { return Rewrite_T(aLine); }
+
+    // Private
+    // //////////////////////////////////////////////////////////////////////
+
+    // The unchanged characters are copied by range, when the first access
+    // changes. A comment starts with ' , // or REM.
+    template <typename C>
+    bool WordRelocation::Rewrite_T(std::basic_string<C>* aLine)
+    {
+        assert(nullptr != aLine);
+
+        const auto& lIn = *aLine;
+
+        auto lLength = static_cast<unsigned int>(lIn.size());
+
+        std::basic_string<C> lOut;
+
+        unsigned int lCopied = 0;
+        unsigned int i       = 0;
+
+        while (lLength > i)
+        {
+            auto lC = static_cast<unsigned int>(lIn[i]);
+
+            if (IsNameFirst(lC))
+            {
+                auto lBegin = i;
+
+                while ((lLength > i) && IsNameChar(lIn[i])) { i++; }
+
+                if (IsName(lIn.c_str() + lBegin, i - lBegin, "REM"))
+                {
+                    break;
+                }
+
+                if ((lLength > i) && ('[' == lIn[i]) && IsName(lIn.c_str() + lBegin, i - lBegin, "DM"))
+                {
+                    i++;
+
+                    auto lFirst = i;
+                    unsigned int lFrom = 0;
+
+                    while ((lLength > i) && IsDigit(lIn[i]) && (OFFSET_MAX >= lFrom))
+                    {
+                        lFrom = lFrom * 10 + (lIn[i] - '0');
+                        i++;
+                    }
+
+                    auto lEnd = i;
+
+                    if ((lFirst == lEnd) || (lLength <= lEnd) || (']' != lIn[lEnd]))
+                    {
+                        mIndirectCount++;
+                    }
+                    else if ((OFFSET_MAX >= lFrom) && (0 != mTo[lFrom]))
+                    {
+                        lOut.append(lIn, lCopied, lFirst - lCopied);
+
+                        for (auto lD : std::to_string(mTo[lFrom]))
+                        {
+                            lOut += static_cast<C>(lD);
+                        }
+
+                        lCopied = lEnd;
+
+                        mRewriteCount++;
+                    }
+                }
+            }
+            else if (IsDigit(lC))
+            {
+                // A number may contain letters, 1E3 or &H1F
+                while ((lLength > i) && IsNameChar(lIn[i])) { i++; }
+            }
+            else if ('"' == lC)
+            {
+                i++;
+
+                while ((lLength > i) && ('"' != lIn[i])) { i++; }
+
+                if (lLength > i)
+                {
+                    i++;
+                }
+            }
+            else if (('\'' == lC) || (('/' == lC) && (lLength > i + 1) && ('/' == lIn[i + 1])))
+            {
+                break;
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        if (0 == lCopied)
+        {
+            return false;
+        }
+
+        lOut.append(lIn, lCopied, std::basic_string<C>::npos);
+
+        *aLine = lOut;
+
+        return true;
+    }
+
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+bool IsDigit(unsigned int aC) { return ('0' <= aC) && ('9' >= aC); }
+
+bool IsNameChar(unsigned int aC)
+{
+    return IsNameFirst(aC) || IsDigit(aC);
+}
+
+bool IsNameFirst(unsigned int aC)
+{
+    return (('A' <= aC) && ('Z' >= aC)) || (('a' <= aC) && ('z' >= aC)) || ('_' == aC);
+}
+
+template <typename C>
+bool IsName(const C* aName, unsigned int aLength, const char* aExpected)
+{
+    assert(nullptr != aName);
+    assert(nullptr != aExpected);
+
+    for (unsigned int i = 0; i < aLength; i++)
+    {
+        auto lC = static_cast<unsigned int>(aName[i]);
+
+        if (('a' <= lC) && ('z' >= lC))
+        {
+            lC -= 'a' - 'A';
+        }
+
+        if (static_cast<unsigned char>(aExpected[i]) != lC)
+        {
+            return false;
+        }
+    }
+
+    return '\0' == aExpected[aLength];
+}
@@ -25,6 +25,12 @@ const char* ADDRESS_TYPE_NAMES[] =
     "UNKNOWN",
 };
 
+const char* HEADER_TYPE_NAMES[] =
+{
+    "DEFINE",
+    "CONSTEXPR",
+};
+
 const char* PROJECT_TYPE_NAMES[] =
 {
     "LEGACY",
@@ -7,12 +7,254 @@
 
 #include "Component.h"
 
+// ===== C++ ================================================================
+#include <algorithm>
+#include <string>
+#include <tuple>
+
+// ===== Windows ============================================================
+#include <Windows.h>
+
+// ===== Import/Includes ====================================================
+#include <KMS/File/Binary.h>
+
 // ===== Local ==============================================================
 #include "Utilities.h"
 
+using namespace KMS;
+
+KMS_RESULT_STATIC(RESULT_DELTA_NOT_FOUND);
+KMS_RESULT_STATIC(RESULT_REPLACE_FAILED);
+
+// Data type and constants
+// //////////////////////////////////////////////////////////////////////////
+
+#define DELTA_MAGIC (0x41544c44) // DLTA
+
+#define FNV_OFFSET (0xcbf29ce484222325ULL)
+#define FNV_PRIME  (0x00000100000001b3ULL)
+
+typedef struct
+{
+    uint32_t mMagic;
+    uint32_t mPrefix_byte;
+    uint32_t mSuffix_byte;
+    uint32_t mOldSize_byte;
+
+    // The hash of the new content, the delta applies only to it
+    uint64_t mNewHash;
+}
+DeltaHeader;
+
+// Static function declarations
+// //////////////////////////////////////////////////////////////////////////
+
+// aOut  The name of the delta file
+static void Backup_Delta(const File::Folder& aFolder, const char* aFileName, const char* aBackup, char* aOut, unsigned int aOutSize_byte);
+
 // Functions
 // //////////////////////////////////////////////////////////////////////////
 
+void Utl_Delta_Apply(const std::vector<uint8_t>& aDelta, const std::vector<uint8_t>& aNew, std::vector<uint8_t>* aOut)
+{
+    assert(nullptr != aOut);
+
+    DeltaHeader lHeader;
+
+    KMS_EXCEPTION_ASSERT(sizeof(lHeader) <= aDelta.size(), RESULT_INVALID_FORMAT, "Invalid delta", "");
+
+    memcpy(&lHeader, aDelta.data(), sizeof(lHeader));
+
+    auto lMiddle_byte = static_cast<unsigned int>(aDelta.size() - sizeof(lHeader));
+
+    KMS_EXCEPTION_ASSERT(DELTA_MAGIC == lHeader.mMagic, RESULT_INVALID_FORMAT, "Invalid delta", "");
+    KMS_EXCEPTION_ASSERT(lHeader.mOldSize_byte == lHeader.mPrefix_byte + lMiddle_byte + lHeader.mSuffix_byte, RESULT_INVALID_FORMAT, "Invalid delta", "");
+    KMS_EXCEPTION_ASSERT(aNew.size() >= static_cast<uint64_t>(lHeader.mPrefix_byte) + lHeader.mSuffix_byte, RESULT_INVALID_FORMAT, "The delta does not apply to this content", "");
+    KMS_EXCEPTION_ASSERT(Utl_Hash(aNew.data(), static_cast<unsigned int>(aNew.size())) == lHeader.mNewHash, RESULT_INVALID_FORMAT, "The delta does not apply to this content", "");
+
+    aOut->clear();
+    aOut->reserve(lHeader.mOldSize_byte);
+
+    aOut->insert(aOut->end(), aNew.begin(), aNew.begin() + lHeader.mPrefix_byte);
+    aOut->insert(aOut->end(), aDelta.begin() + sizeof(lHeader), aDelta.end());
+    aOut->insert(aOut->end(), aNew.end() - lHeader.mSuffix_byte, aNew.end());
+}
+
+// Successive versions of a file usually differ in one place, so the common
+// prefix and suffix cover most of the content.
+void Utl_Delta_Create(const std::vector<uint8_t>& aOld, const std::vector<uint8_t>& aNew, std::vector<uint8_t>* aOut)
+{
+    assert(nullptr != aOut);
+
+    auto lMax_byte = static_cast<unsigned int>((aOld.size() < aNew.size()) ? aOld.size() : aNew.size());
+
+    unsigned int lPrefix_byte = 0;
+
+    while ((lMax_byte > lPrefix_byte) && (aOld[lPrefix_byte] == aNew[lPrefix_byte]))
+    {
+        lPrefix_byte++;
+    }
+
+    unsigned int lSuffix_byte = 0;
+
+    while ((lMax_byte - lPrefix_byte > lSuffix_byte) && (aOld[aOld.size() - 1 - lSuffix_byte] == aNew[aNew.size() - 1 - lSuffix_byte]))
+    {
+        lSuffix_byte++;
+    }
+
+    DeltaHeader lHeader;
+
+    lHeader.mMagic        = DELTA_MAGIC;
+    lHeader.mNewHash      = Utl_Hash(aNew.data(), static_cast<unsigned int>(aNew.size()));
+    lHeader.mOldSize_byte = static_cast<uint32_t>(aOld.size());
+    lHeader.mPrefix_byte  = lPrefix_byte;
+    lHeader.mSuffix_byte  = lSuffix_byte;
+
+    auto lHeader_byte = reinterpret_cast<const uint8_t*>(&lHeader);
+
+    aOut->assign(lHeader_byte, lHeader_byte + sizeof(lHeader));
+    aOut->insert(aOut->end(), aOld.begin() + lPrefix_byte, aOld.end() - lSuffix_byte);
+}
+
+void Utl_Delta_Restore(const File::Folder& aFolder, const char* aBackup, const char* aDelta, std::vector<uint8_t>* aOut)
+{
+    assert(nullptr != aBackup);
+    assert(nullptr != aDelta);
+    assert(nullptr != aOut);
+
+    std::string lBackup(aBackup);
+
+    auto lSeparator = lBackup.find_last_of("/\\");
+    auto lDir = (std::string::npos == lSeparator) ? std::string() : lBackup.substr(0, lSeparator + 1);
+
+    std::string lDelta(aDelta);
+
+    lSeparator = lDelta.find_last_of("/\\");
+    if (std::string::npos != lSeparator)
+    {
+        lDelta = lDelta.substr(lSeparator + 1);
+    }
+
+    auto lName = lBackup.substr(lDir.size());
+
+    char lPattern[PATH_LENGTH];
+    char lPath   [PATH_LENGTH];
+
+    sprintf_s(lPattern, "%s.*.delta", aBackup);
+
+    aFolder.GetPath(lPattern, lPath, sizeof(lPath));
+
+    std::vector<std::string> lDeltas;
+
+    WIN32_FIND_DATAA lData;
+
+    auto lHandle = FindFirstFileA(lPath, &lData);
+    if (INVALID_HANDLE_VALUE != lHandle)
+    {
+        do
+        {
+            lDeltas.push_back(lData.cFileName);
+        }
+        while (FindNextFileA(lHandle, &lData));
+
+        FindClose(lHandle);
+    }
+
+    Utl_Delta_Sort(lName.c_str(), &lDeltas);
+
+    auto lEnd = std::find_if(lDeltas.begin(), lDeltas.end(), [&lDelta](const std::string& aD) { return 0 == _stricmp(aD.c_str(), lDelta.c_str()); });
+
+    KMS_EXCEPTION_ASSERT(lDeltas.end() != lEnd, RESULT_DELTA_NOT_FOUND, "The delta file does not exist", aDelta);
+
+    Utl_ReadFile(aFolder, aBackup, aOut);
+
+    for (auto lIt = lDeltas.begin(); lIt <= lEnd; lIt++)
+    {
+        std::vector<uint8_t> lData_Delta;
+        std::vector<uint8_t> lOld;
+
+        Utl_ReadFile(aFolder, (lDir + *lIt).c_str(), &lData_Delta);
+
+        Utl_Delta_Apply(lData_Delta, *aOut, &lOld);
+
+        aOut->swap(lOld);
+    }
+}
+
+// <aBackup>.<YYYYMMDD>_<HHMMSS>_<N>.delta, the date, the time, then the
+// number of the writes in the same second give the order. The number has
+// no leading zero, so comparing the names would put _10 before _9.
+void Utl_Delta_Sort(const char* aBackup, std::vector<std::string>* aInOut)
+{
+    assert(nullptr != aBackup);
+    assert(nullptr != aInOut);
+
+    typedef std::tuple<unsigned int, unsigned int, unsigned int> Key;
+
+    std::vector<std::pair<Key, std::string>> lDeltas;
+
+    auto lPrefix_byte = strlen(aBackup);
+
+    for (const auto& lName : *aInOut)
+    {
+        unsigned int lDate;
+        unsigned int lN;
+        unsigned int lTime;
+        char         lSuffix[8];
+
+        if ((lName.size() > lPrefix_byte + 1)
+            && (0 == _strnicmp(aBackup, lName.c_str(), lPrefix_byte))
+            && ('.' == lName[lPrefix_byte])
+            && (4 == sscanf_s(lName.c_str() + lPrefix_byte + 1, "%8u_%6u_%u.%7s", &lDate, &lTime, &lN, lSuffix SizeInfo(lSuffix)))
+            && (0 == _stricmp("delta", lSuffix)))
+        {
+            lDeltas.push_back(std::make_pair(Key(lDate, lTime, lN), lName));
+        }
+    }
+
+    std::sort(lDeltas.begin(), lDeltas.end(), [](const std::pair<Key, std::string>& aA, const std::pair<Key, std::string>& aB)
+        {
+            return aA.first > aB.first;
+        });
+
+    aInOut->clear();
+
+    for (const auto& lDelta : lDeltas)
+    {
+        aInOut->push_back(lDelta.second);
+    }
+}
+
+uint64_t Utl_Hash(const void* aData, unsigned int aSize_byte)
+{
+    assert((nullptr != aData) || (0 == aSize_byte));
+
+    auto lData = reinterpret_cast<const uint8_t*>(aData);
+
+    uint64_t lResult = FNV_OFFSET;
+
+    for (unsigned int i = 0; i < aSize_byte; i++)
+    {
+        lResult ^= lData[i];
+        lResult *= FNV_PRIME;
+    }
+
+    return lResult;
+}
+
+void Utl_ReadFile(const File::Folder& aFolder, const char* aFileName, std::vector<uint8_t>* aOut)
+{
+    assert(nullptr != aFileName);
+    assert(nullptr != aOut);
+
+    File::Binary lFile(aFolder, aFileName);
+
+    auto lData      = reinterpret_cast<const uint8_t*>(lFile.Map());
+    auto lSize_byte = lFile.GetMappedSize();
+
+    aOut->assign(lData, lData + lSize_byte);
+}
+
 void Utl_RemoveSpecialChar(std::string* aInOut)
 {
     assert(nullptr != aInOut);
@@ -55,3 +297,144 @@ void Utl_RemoveSpecialChar(std::string* aInOut)
         }
     }
 }
+
+void Utl_ReplaceFile(const File::Folder& aFolder, const char* aFileName, const std::vector<uint8_t>& aData, const char* aBackup)
+{
+    assert(nullptr != aFileName);
+
+    char lTemp[PATH_LENGTH];
+
+    sprintf_s(lTemp, "%s.tmp", aFileName);
+
+    {
+        File::Binary lFile(aFolder, lTemp, true);
+
+        lFile.Write(aData.data(), static_cast<unsigned int>(aData.size()));
+    }
+
+    char lPath      [PATH_LENGTH];
+    char lPath_Temp [PATH_LENGTH];
+
+    aFolder.GetPath(aFileName, lPath     , sizeof(lPath));
+    aFolder.GetPath(lTemp    , lPath_Temp, sizeof(lPath_Temp));
+
+    BOOL lRet;
+
+    if ((nullptr != aBackup) && aFolder.DoesFileExist(aFileName))
+    {
+        char lPath_Backup[PATH_LENGTH];
+
+        aFolder.GetPath(aBackup, lPath_Backup, sizeof(lPath_Backup));
+
+        char lDelta           [PATH_LENGTH];
+        char lPath_BackupTemp [PATH_LENGTH];
+
+        auto lMoved = false;
+
+        // The previous backup is moved aside, not deleted, so it comes back
+        // when the replacement fails.
+        if (aFolder.DoesFileExist(aBackup))
+        {
+            Backup_Delta(aFolder, aFileName, aBackup, lDelta, sizeof(lDelta));
+
+            sprintf_s(lPath_BackupTemp, "%s.tmp", lPath_Backup);
+
+            lMoved = MoveFileExA(lPath_Backup, lPath_BackupTemp, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+            if (!lMoved)
+            {
+                aFolder.Delete(lDelta);
+            }
+
+            KMS_EXCEPTION_ASSERT(lMoved, RESULT_REPLACE_FAILED, "Cannot move the previous backup", aBackup);
+        }
+
+        lRet = ReplaceFileA(lPath, lPath_Temp, lPath_Backup, REPLACEFILE_IGNORE_MERGE_ERRORS, nullptr, nullptr);
+
+        if (lMoved)
+        {
+            if (lRet)
+            {
+                DeleteFileA(lPath_BackupTemp);
+            }
+            else
+            {
+                MoveFileExA(lPath_BackupTemp, lPath_Backup, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+
+                aFolder.Delete(lDelta);
+            }
+        }
+    }
+    else
+    {
+        lRet = MoveFileExA(lPath_Temp, lPath, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+    }
+
+    KMS_EXCEPTION_ASSERT(lRet, RESULT_REPLACE_FAILED, "Cannot replace the file", aFileName);
+}
+
+bool Utl_WriteIfChanged(const File::Folder& aFolder, const char* aFileName, const std::vector<uint8_t>& aData)
+{
+    assert(nullptr != aFileName);
+
+    if (aFolder.DoesFileExist(aFileName))
+    {
+        std::vector<uint8_t> lOld;
+
+        Utl_ReadFile(aFolder, aFileName, &lOld);
+
+        if (lOld == aData)
+        {
+            return false;
+        }
+    }
+
+    Utl_ReplaceFile(aFolder, aFileName, aData, nullptr);
+
+    return true;
+}
+
+// Static functions
+// //////////////////////////////////////////////////////////////////////////
+
+// The backup becomes a delta against the content replacing it in the
+// backup, so only the last backup is a full copy. Applying the deltas from
+// the newest to the oldest rebuilds each previous version.
+void Backup_Delta(const File::Folder& aFolder, const char* aFileName, const char* aBackup, char* aOut, unsigned int aOutSize_byte)
+{
+    assert(nullptr != aFileName);
+    assert(nullptr != aBackup);
+    assert(nullptr != aOut);
+
+    std::vector<uint8_t> lDelta;
+    std::vector<uint8_t> lNew;
+    std::vector<uint8_t> lOld;
+
+    Utl_ReadFile(aFolder, aBackup  , &lOld);
+    Utl_ReadFile(aFolder, aFileName, &lNew);
+
+    Utl_Delta_Create(lOld, lNew, &lDelta);
+
+    auto lNow = time(nullptr);
+
+    struct tm lTime;
+
+    auto lRet = localtime_s(&lTime, &lNow);
+    assert(0 == lRet);
+    (void)lRet;
+
+    // Two writes in the same second receive different names
+    for (unsigned int i = 0; ; i++)
+    {
+        sprintf_s(aOut, aOutSize_byte, "%s.%04u%02u%02u_%02u%02u%02u_%u.delta", aBackup,
+            lTime.tm_year + 1900, lTime.tm_mon + 1, lTime.tm_mday, lTime.tm_hour, lTime.tm_min, lTime.tm_sec, i);
+
+        if (!aFolder.DoesFileExist(aOut))
+        {
+            break;
+        }
+    }
+
+    File::Binary lFile(aFolder, aOut, true);
+
+    lFile.Write(lDelta.data(), static_cast<unsigned int>(lDelta.size()));
+}
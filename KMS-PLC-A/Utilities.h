@@ -7,7 +7,63 @@
 
 #pragma once
 
+// ===== C++ ================================================================
+#include <string>
+#include <vector>
+
+// ===== Import/Includes ====================================================
+#include <KMS/File/Folder.h>
+
 // Functions
 // //////////////////////////////////////////////////////////////////////////
 
+// A delta contains the bytes of aOld between the prefix and the suffix it
+// has in common with aNew. Utl_Delta_Apply rebuilds aOld from the delta and
+// aNew.
+//
+// Exception  RESULT_INVALID_FORMAT
+extern void Utl_Delta_Apply (const std::vector<uint8_t>& aDelta, const std::vector<uint8_t>& aNew, std::vector<uint8_t>* aOut);
+extern void Utl_Delta_Create(const std::vector<uint8_t>& aOld  , const std::vector<uint8_t>& aNew, std::vector<uint8_t>* aOut);
+
+// Rebuild the version of a file a delta of its backup gives. The deltas are
+// applied to the backup from the newest to aDelta.
+//
+// aBackup  See Utl_ReplaceFile
+// aDelta   One of the delta files Utl_ReplaceFile created for aBackup
+//
+// Exception  RESULT_DELTA_NOT_FOUND
+//            RESULT_INVALID_FORMAT
+extern void Utl_Delta_Restore(const KMS::File::Folder& aFolder, const char* aBackup, const char* aDelta, std::vector<uint8_t>* aOut);
+
+// Sort the names of the delta files of a backup from the newest to the
+// oldest, using the time and the number of their name. The names without
+// them are removed.
+//
+// aBackup  The name of the backup, without folder
+extern void Utl_Delta_Sort(const char* aBackup, std::vector<std::string>* aInOut);
+
+// 64 bits FNV-1a
+extern uint64_t Utl_Hash(const void* aData, unsigned int aSize_byte);
+
+extern void Utl_ReadFile(const KMS::File::Folder& aFolder, const char* aFileName, std::vector<uint8_t>* aOut);
+
 extern void Utl_RemoveSpecialChar(std::string* aInOut);
+
+// The data is written to a temporary file, which then replaces the file in
+// a single operation. Readers see the previous or the new content, never a
+// partial one.
+//
+// aBackup  The name the previous content receives, or nullptr. The
+//          previous backup becomes a delta file, <aBackup>.<Time>_<N>.delta.
+//          It stays unchanged when the replacement fails.
+//
+// Exception  RESULT_REPLACE_FAILED
+extern void Utl_ReplaceFile(const KMS::File::Folder& aFolder, const char* aFileName, const std::vector<uint8_t>& aData, const char* aBackup);
+
+// The file keeps its time stamp when it already contains the data, so the
+// tools depending on it do not see a change.
+//
+// Return  false when the file already contains the data
+//
+// Exception  RESULT_REPLACE_FAILED
+extern bool Utl_WriteIfChanged(const KMS::File::Folder& aFolder, const char* aFileName, const std::vector<uint8_t>& aData);